@@ -25,7 +25,7 @@ namespace YTE
 
   void ActionManager::Initialize()
   {
-    mOwner->RegisterEvent<&ActionManager::Update>(Events::LogicUpdate, this);
+    mOwner->RegisterTick<&ActionManager::Update>(Events::LogicUpdate, this);
     GetSpace()->RegisterEvent<&ActionManager::OnCompositionRemoved>(Events::CompositionRemoved, this);
   }
 
@@ -0,0 +1,457 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+
+#include "YTE/Core/BinaryDocument.hpp"
+
+#include "YTE/Platform/MappedFile.hpp"
+
+#include "YTE/Utilities/Utilities.hpp"
+
+namespace YTE
+{
+  namespace
+  {
+    // Deeper than any level, just so a corrupt file can't overflow the stack.
+    size_t const cMaximumDepth = 512;
+
+    class BinaryWriter
+    {
+    public:
+      std::vector<byte> Write(RSValue const &aValue)
+      {
+        mData.resize(sizeof(BinaryHeader));
+
+        WriteValue(aValue);
+
+        BinaryHeader header{};
+        header.mMagic = cBinaryDocumentMagic;
+        header.mVersion = cBinaryDocumentVersion;
+        header.mStringsOffset = mData.size();
+        header.mStringCount = static_cast<u32>(mStrings.size());
+
+        size_t entries = mData.size();
+        mData.resize(entries + mStrings.size() * sizeof(BinaryStringEntry));
+
+        for (size_t i = 0; i < mStrings.size(); ++i)
+        {
+          BinaryStringEntry entry;
+          entry.mOffset = static_cast<u32>(mData.size());
+          entry.mLength = static_cast<u32>(mStrings[i]->size());
+
+          mData.insert(mData.end(), mStrings[i]->begin(), mStrings[i]->end());
+          mData.push_back(0);
+
+          std::memcpy(mData.data() + entries + i * sizeof(BinaryStringEntry), &entry, sizeof(entry));
+        }
+
+        mData.resize((mData.size() + 7) & ~size_t{ 7 }, 0);
+
+        header.mSize = mData.size();
+        std::memcpy(mData.data(), &header, sizeof(header));
+
+        return std::move(mData);
+      }
+
+    private:
+      u32 Intern(char const *aString, size_t aLength)
+      {
+        auto inserted = mIndices.emplace(std::string{ aString, aLength },
+                                         static_cast<u32>(mStrings.size()));
+
+        if (inserted.second)
+        {
+          mStrings.emplace_back(&inserted.first->first);
+        }
+
+        return inserted.first->second;
+      }
+
+      void WriteValue(RSValue const &aValue)
+      {
+        size_t offset = mData.size();
+        mData.resize(offset + sizeof(BinaryNode));
+
+        BinaryNode node{};
+
+        switch (aValue.GetType())
+        {
+          case rapidjson::kNullType:
+          {
+            node.mKind = BinaryKind::Null;
+            break;
+          }
+          case rapidjson::kFalseType:
+          {
+            node.mKind = BinaryKind::False;
+            break;
+          }
+          case rapidjson::kTrueType:
+          {
+            node.mKind = BinaryKind::True;
+            break;
+          }
+          case rapidjson::kNumberType:
+          {
+            if (aValue.IsDouble())
+            {
+              node.mKind = BinaryKind::Double;
+              node.mDouble = aValue.GetDouble();
+            }
+            else if (aValue.IsInt64())
+            {
+              node.mKind = BinaryKind::Int64;
+              node.mInt64 = aValue.GetInt64();
+            }
+            else
+            {
+              node.mKind = BinaryKind::Uint64;
+              node.mUint64 = aValue.GetUint64();
+            }
+
+            break;
+          }
+          case rapidjson::kStringType:
+          {
+            node.mKind = BinaryKind::String;
+            node.mCount = Intern(aValue.GetString(), aValue.GetStringLength());
+            break;
+          }
+          case rapidjson::kArrayType:
+          {
+            node.mKind = BinaryKind::Array;
+            node.mCount = aValue.Size();
+
+            for (auto element = aValue.Begin(); element != aValue.End(); ++element)
+            {
+              WriteValue(*element);
+            }
+
+            node.mSize = mData.size() - offset - sizeof(BinaryNode);
+            break;
+          }
+          case rapidjson::kObjectType:
+          {
+            node.mKind = BinaryKind::Object;
+            node.mCount = aValue.MemberCount();
+
+            for (auto member = aValue.MemberBegin(); member != aValue.MemberEnd(); ++member)
+            {
+              WriteValue(member->name);
+              WriteValue(member->value);
+            }
+
+            node.mSize = mData.size() - offset - sizeof(BinaryNode);
+            break;
+          }
+        }
+
+        std::memcpy(mData.data() + offset, &node, sizeof(node));
+      }
+
+      std::vector<byte> mData;
+      std::unordered_map<std::string, u32> mIndices;
+
+      // In index order, pointing at the keys of mIndices.
+      std::vector<std::string const*> mStrings;
+    };
+  }
+
+  BinaryDocument::BinaryDocument(byte const *aData, size_t aSize)
+    : mData(aData)
+    , mRoot(nullptr)
+    , mStrings(nullptr)
+    , mStringCount(0)
+    , mValid(false)
+  {
+    if (nullptr == aData ||
+        aSize < sizeof(BinaryHeader) + sizeof(BinaryNode) ||
+        0 != reinterpret_cast<std::uintptr_t>(aData) % alignof(BinaryNode))
+    {
+      return;
+    }
+
+    auto header = reinterpret_cast<BinaryHeader const*>(aData);
+
+    if (cBinaryDocumentMagic != header->mMagic ||
+        cBinaryDocumentVersion != header->mVersion ||
+        aSize != header->mSize ||
+        header->mStringsOffset < sizeof(BinaryHeader) + sizeof(BinaryNode) ||
+        header->mStringsOffset > aSize ||
+        0 != header->mStringsOffset % alignof(BinaryNode) ||
+        header->mStringCount > (aSize - header->mStringsOffset) / sizeof(BinaryStringEntry))
+    {
+      return;
+    }
+
+    mStrings = reinterpret_cast<BinaryStringEntry const*>(aData + header->mStringsOffset);
+    mStringCount = header->mStringCount;
+
+    size_t stringsBegin = header->mStringsOffset + mStringCount * sizeof(BinaryStringEntry);
+
+    for (u32 i = 0; i < mStringCount; ++i)
+    {
+      auto &entry = mStrings[i];
+
+      if (entry.mOffset < stringsBegin ||
+          entry.mOffset >= aSize ||
+          entry.mLength >= aSize - entry.mOffset ||
+          0 != aData[entry.mOffset + entry.mLength])
+      {
+        return;
+      }
+    }
+
+    mRoot = reinterpret_cast<BinaryNode const*>(aData + sizeof(BinaryHeader));
+    auto end = reinterpret_cast<BinaryNode const*>(aData + header->mStringsOffset);
+
+    mValid = Validate(mRoot, end, 0) && GetNext(mRoot) == end;
+  }
+
+  bool BinaryDocument::Validate(BinaryNode const *aNode, BinaryNode const *aEnd, size_t aDepth)
+  {
+    if (aNode >= aEnd || aDepth > cMaximumDepth)
+    {
+      return false;
+    }
+
+    switch (aNode->mKind)
+    {
+      case BinaryKind::Null:
+      case BinaryKind::False:
+      case BinaryKind::True:
+      case BinaryKind::Int64:
+      case BinaryKind::Uint64:
+      case BinaryKind::Double:
+      {
+        return true;
+      }
+      case BinaryKind::String:
+      {
+        return aNode->mCount < mStringCount;
+      }
+      case BinaryKind::Array:
+      case BinaryKind::Object:
+      {
+        auto available = static_cast<u64>(aEnd - (aNode + 1));
+
+        if (0 != aNode->mSize % sizeof(BinaryNode) ||
+            aNode->mSize / sizeof(BinaryNode) > available)
+        {
+          return false;
+        }
+
+        bool isObject = BinaryKind::Object == aNode->mKind;
+        u64 children = isObject ? u64{ aNode->mCount } * 2 : aNode->mCount;
+
+        auto end = GetNext(aNode);
+        auto child = GetFirstChild(aNode);
+
+        for (u64 i = 0; i < children; ++i)
+        {
+          // Member names have to be strings.
+          if (false == Validate(child, end, aDepth + 1) ||
+              (isObject && 0 == i % 2 && BinaryKind::String != child->mKind))
+          {
+            return false;
+          }
+
+          child = GetNext(child);
+        }
+
+        return child == end;
+      }
+    }
+
+    return false;
+  }
+
+  BinaryNode const* BinaryDocument::FindMember(BinaryNode const *aObject, char const *aName) const
+  {
+    size_t length = std::strlen(aName);
+    auto name = GetFirstChild(aObject);
+
+    for (u32 i = 0; i < aObject->mCount; ++i)
+    {
+      auto value = GetNext(name);
+
+      if (length == GetStringLength(name->mCount) &&
+          0 == std::memcmp(aName, GetString(name->mCount), length))
+      {
+        return value;
+      }
+
+      name = GetNext(value);
+    }
+
+    return nullptr;
+  }
+
+  void BinaryDocument::ToJson(BinaryNode const *aNode,
+                              RSValue &aValue,
+                              RSAllocator &aAllocator,
+                              bool aCopyStrings) const
+  {
+    switch (aNode->mKind)
+    {
+      case BinaryKind::Null:
+      {
+        aValue.SetNull();
+        break;
+      }
+      case BinaryKind::False:
+      {
+        aValue.SetBool(false);
+        break;
+      }
+      case BinaryKind::True:
+      {
+        aValue.SetBool(true);
+        break;
+      }
+      case BinaryKind::Int64:
+      {
+        aValue.SetInt64(aNode->mInt64);
+        break;
+      }
+      case BinaryKind::Uint64:
+      {
+        aValue.SetUint64(aNode->mUint64);
+        break;
+      }
+      case BinaryKind::Double:
+      {
+        aValue.SetDouble(aNode->mDouble);
+        break;
+      }
+      case BinaryKind::String:
+      {
+        if (aCopyStrings)
+        {
+          aValue.SetString(GetString(aNode->mCount), GetStringLength(aNode->mCount), aAllocator);
+        }
+        else
+        {
+          aValue.SetString(rapidjson::StringRef(GetString(aNode->mCount), GetStringLength(aNode->mCount)));
+        }
+
+        break;
+      }
+      case BinaryKind::Array:
+      {
+        aValue.SetArray();
+        aValue.Reserve(aNode->mCount, aAllocator);
+
+        auto child = GetFirstChild(aNode);
+
+        for (u32 i = 0; i < aNode->mCount; ++i)
+        {
+          RSValue element;
+          ToJson(child, element, aAllocator, aCopyStrings);
+          aValue.PushBack(element, aAllocator);
+
+          child = GetNext(child);
+        }
+
+        break;
+      }
+      case BinaryKind::Object:
+      {
+        aValue.SetObject();
+
+        auto child = GetFirstChild(aNode);
+
+        for (u32 i = 0; i < aNode->mCount; ++i)
+        {
+          RSValue name;
+          ToJson(child, name, aAllocator, aCopyStrings);
+          child = GetNext(child);
+
+          RSValue value;
+          ToJson(child, value, aAllocator, aCopyStrings);
+          child = GetNext(child);
+
+          aValue.AddMember(name, value, aAllocator);
+        }
+
+        break;
+      }
+    }
+  }
+
+  std::vector<byte> WriteBinaryDocument(RSValue const &aValue)
+  {
+    YTEProfileFunction();
+
+    BinaryWriter writer;
+    return writer.Write(aValue);
+  }
+
+  std::string GetBinaryPath(std::string const &aJsonPath)
+  {
+    filesystem::path path{ aJsonPath };
+    path.replace_extension(cBinaryDocumentExtension);
+
+    return path.string();
+  }
+
+  bool HasCurrentBinary(std::string const &aJsonPath)
+  {
+    std::error_code error;
+    auto binaryPath = GetBinaryPath(aJsonPath);
+
+    if (false == filesystem::exists(binaryPath, error))
+    {
+      return false;
+    }
+
+    if (false == filesystem::exists(aJsonPath, error))
+    {
+      return true;
+    }
+
+    return filesystem::last_write_time(binaryPath, error) >=
+           filesystem::last_write_time(aJsonPath, error);
+  }
+
+  bool WriteBinaryFile(std::string const &aPath, RSValue const &aValue)
+  {
+    auto data = WriteBinaryDocument(aValue);
+
+    std::ofstream file{ aPath, std::ios::binary | std::ios::trunc };
+    file.write(reinterpret_cast<char const*>(data.data()), data.size());
+
+    return file.good();
+  }
+
+  bool ReadBinaryFile(std::string const &aPath, RSDocument &aDocument)
+  {
+    YTEProfileFunction();
+
+    MappedFile file{ aPath };
+
+    if (false == file.IsOpen())
+    {
+      return false;
+    }
+
+    BinaryDocument document{ file.GetData(), file.GetSize() };
+
+    if (false == document.IsValid())
+    {
+      return false;
+    }
+
+    document.ToJson(document.GetRoot(), aDocument, aDocument.GetAllocator());
+    return true;
+  }
+}
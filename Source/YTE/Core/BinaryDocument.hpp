@@ -0,0 +1,176 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#pragma once
+
+#ifndef YTE_Core_BinaryDocument_hpp
+#define YTE_Core_BinaryDocument_hpp
+
+#include <string>
+#include <vector>
+
+#include "YTE/Core/Utilities.hpp"
+
+namespace YTE
+{
+  // A binary form of the JSON that levels and archetypes are serialized to,
+  // laid out to be read in place from a mapped file. JSON stays the source
+  // format; converting to binary and back gives the same document.
+  //
+  // Layout (little endian, everything 8 byte aligned):
+  //   BinaryHeader
+  //   The root BinaryNode, followed by its descendants in document order.
+  //   Each string's BinaryStringEntry, then the strings, null terminated.
+  //
+  // Object members are a String node for the name followed by the value.
+  // Arrays and objects record how many bytes their descendants take, so a
+  // value (like a component's properties) is one contiguous block that can be
+  // skipped over without reading it.
+  constexpr u32 cBinaryDocumentMagic = 0x42455459; // "YTEB"
+  constexpr u32 cBinaryDocumentVersion = 1;
+
+  // Kept next to the JSON file it was made from, see GetBinaryPath.
+  constexpr char const *cBinaryDocumentExtension = ".yteb";
+
+  enum class BinaryKind : u32
+  {
+    Null,
+    False,
+    True,
+    Int64,
+    Uint64,
+    Double,
+    String,
+    Array,
+    Object
+  };
+
+  struct BinaryHeader
+  {
+    u32 mMagic;
+    u32 mVersion;
+    u64 mSize;
+    u64 mStringsOffset;
+    u32 mStringCount;
+    u32 mPadding;
+  };
+
+  struct BinaryNode
+  {
+    BinaryKind mKind;
+
+    // The string's index for strings, the number of elements or members for
+    // arrays and objects.
+    u32 mCount;
+
+    union
+    {
+      i64 mInt64;
+      u64 mUint64;
+      double mDouble;
+
+      // Arrays and objects, bytes taken by everything inside them.
+      u64 mSize;
+    };
+  };
+
+  struct BinaryStringEntry
+  {
+    u32 mOffset;
+    u32 mLength;
+  };
+
+  static_assert(sizeof(BinaryHeader) == 32, "BinaryHeader is part of the file format.");
+  static_assert(sizeof(BinaryNode) == 16, "BinaryNode is part of the file format.");
+
+  // Reads a binary document in place, aData must outlive it and be 8 byte
+  // aligned (mapped files are). The whole document is checked when it's
+  // made, so nothing read through a valid one goes out of bounds.
+  class BinaryDocument
+  {
+  public:
+    YTE_Shared BinaryDocument(byte const *aData, size_t aSize);
+
+    bool IsValid() const
+    {
+      return mValid;
+    }
+
+    BinaryNode const* GetRoot() const
+    {
+      return mRoot;
+    }
+
+    u32 GetStringCount() const
+    {
+      return mStringCount;
+    }
+
+    char const* GetString(u32 aIndex) const
+    {
+      return reinterpret_cast<char const*>(mData + mStrings[aIndex].mOffset);
+    }
+
+    u32 GetStringLength(u32 aIndex) const
+    {
+      return mStrings[aIndex].mLength;
+    }
+
+    // The first element of an array, or the first member's name in an
+    // object (its value is the node after that).
+    static BinaryNode const* GetFirstChild(BinaryNode const *aNode)
+    {
+      return aNode + 1;
+    }
+
+    // The node after aNode and everything inside it.
+    static BinaryNode const* GetNext(BinaryNode const *aNode)
+    {
+      if (BinaryKind::Array == aNode->mKind || BinaryKind::Object == aNode->mKind)
+      {
+        return aNode + 1 + aNode->mSize / sizeof(BinaryNode);
+      }
+
+      return aNode + 1;
+    }
+
+    // The value of the first member of aObject named aName, or nullptr.
+    YTE_Shared BinaryNode const* FindMember(BinaryNode const *aObject, char const *aName) const;
+
+    // Converts aNode back to JSON. Without aCopyStrings the strings point
+    // into this document's data, so aValue mustn't outlive it.
+    YTE_Shared void ToJson(BinaryNode const *aNode,
+                           RSValue &aValue,
+                           RSAllocator &aAllocator,
+                           bool aCopyStrings = true) const;
+
+  private:
+    bool Validate(BinaryNode const *aNode, BinaryNode const *aEnd, size_t aDepth);
+
+    byte const *mData;
+    BinaryNode const *mRoot;
+    BinaryStringEntry const *mStrings;
+    u32 mStringCount;
+    bool mValid;
+  };
+
+  YTE_Shared std::vector<byte> WriteBinaryDocument(RSValue const &aValue);
+
+  // Where the binary form of the JSON file at aJsonPath is kept.
+  YTE_Shared std::string GetBinaryPath(std::string const &aJsonPath);
+
+  // If there's a binary form of aJsonPath at least as new as it, or the
+  // binary form is all there is.
+  YTE_Shared bool HasCurrentBinary(std::string const &aJsonPath);
+
+  YTE_Shared bool WriteBinaryFile(std::string const &aPath, RSValue const &aValue);
+
+  // Reads a binary file written by WriteBinaryFile into aDocument. False if
+  // it couldn't be opened or isn't a valid binary document.
+  YTE_Shared bool ReadBinaryFile(std::string const &aPath, RSDocument &aDocument);
+}
+
+#endif
@@ -0,0 +1,300 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#include "YTE/Core/Blueprint.hpp"
+#include "YTE/Core/ComponentFactory.hpp"
+#include "YTE/Core/ComponentSystem.hpp"
+#include "YTE/Core/Composition.hpp"
+#include "YTE/Core/Engine.hpp"
+
+#include "YTE/Utilities/JsonHelpers.hpp"
+
+namespace YTE
+{
+  Blueprint::Blueprint(Engine *aEngine, RSValue *aArchetype)
+    : mEngine(aEngine)
+    , mValid(false)
+  {
+    mValid = Compile(mRoot, aArchetype);
+  }
+
+  bool Blueprint::Compile(Node &aNode, RSValue *aValue)
+  {
+    if (nullptr == aValue ||
+        false == aValue->IsObject() ||
+        false == aValue->HasMember("Compositions") ||
+        false == (*aValue)["Compositions"].IsObject() ||
+        false == aValue->HasMember("Components") ||
+        false == (*aValue)["Components"].IsObject())
+    {
+      return false;
+    }
+
+    auto componentSystem = mEngine->GetComponent<ComponentSystem>();
+    auto &components = (*aValue)["Components"];
+
+    for (auto componentIt = components.MemberBegin();
+         componentIt < components.MemberEnd();
+         ++componentIt)
+    {
+      std::string componentTypeName = componentIt->name.GetString();
+      BoundType *componentType = Type::GetGlobalType(componentTypeName);
+
+      auto factory = componentType ? componentSystem->GetComponentFactory(componentType) : nullptr;
+
+      if (nullptr == factory)
+      {
+        if (componentType)
+        {
+          mMissingFactories.emplace_back(componentType);
+        }
+
+        continue;
+      }
+
+      ComponentRecipe recipe;
+      recipe.mType = componentType;
+      recipe.mFactory = factory;
+      recipe.mProperties = nullptr;
+
+      if (false == CompileProperties(recipe, &componentIt->value))
+      {
+        recipe.mSettings.clear();
+        recipe.mProperties = &componentIt->value;
+      }
+
+      aNode.mComponents.emplace_back(std::move(recipe));
+    }
+
+    auto &compositions = (*aValue)["Compositions"];
+
+    for (auto compositionIt = compositions.MemberBegin();
+         compositionIt < compositions.MemberEnd();
+         ++compositionIt)
+    {
+      Node child;
+      child.mName = compositionIt->name.GetString();
+
+      if (false == Compile(child, &compositionIt->value))
+      {
+        return false;
+      }
+
+      aNode.mChildren.emplace_back(std::move(child));
+    }
+
+    if (aValue->HasMember("Archetype"))
+    {
+      aNode.mHasArchetypeName = true;
+      aNode.mArchetypeName = (*aValue)["Archetype"].GetString();
+    }
+
+    return true;
+  }
+
+  // Mirrors Object::DeserializeByType, returning false for anything it
+  // doesn't handle so the component can be deserialized by it instead.
+  bool Blueprint::CompileProperties(ComponentRecipe &aRecipe, RSValue *aProperties)
+  {
+    if (rapidjson::kObjectType != aProperties->GetType())
+    {
+      return true;
+    }
+
+    Type *type = aRecipe.mType;
+    bool deserializedEditorHeader{ false };
+
+    for (auto propertiesIt = aProperties->MemberBegin(); propertiesIt < aProperties->MemberEnd(); ++propertiesIt)
+    {
+      std::string propertyName = propertiesIt->name.GetString();
+      RSValue *value = &propertiesIt->value;
+
+      Setting setting;
+      setting.mSetter = nullptr;
+      setting.mAttribute = nullptr;
+      setting.mValue = value;
+
+      Property *namedProperty = Object::GetProperty(propertyName, type);
+
+      if (namedProperty == nullptr)
+      {
+        if (auto listerAttribute = type->GetAttribute<EditorHeaderList>();
+            nullptr != listerAttribute &&
+            false == deserializedEditorHeader &&
+            listerAttribute->GetName() == propertyName)
+        {
+          setting.mKind = Setting::Kind::EditorHeader;
+          setting.mAttribute = listerAttribute;
+          aRecipe.mSettings.emplace_back(std::move(setting));
+          deserializedEditorHeader = true;
+          continue;
+        }
+
+        // Let DeserializeByType tell them about it, every time as it would have.
+        return false;
+      }
+
+      if (auto redirectAttribute = namedProperty->GetAttribute<RedirectObject>();
+          nullptr != redirectAttribute)
+      {
+        setting.mKind = Setting::Kind::Redirect;
+        setting.mAttribute = redirectAttribute;
+        aRecipe.mSettings.emplace_back(std::move(setting));
+        continue;
+      }
+
+      auto setter = namedProperty->GetSetter();
+      auto setterType = setter->GetParameters().at(1).mType->GetMostBasicType();
+
+      setting.mKind = Setting::Kind::Setter;
+      setting.mSetter = setter;
+      setting.mArguments.emplace_back(static_cast<Object*>(nullptr));
+
+      if (setterType == TypeId<float>())
+      {
+        setting.mArguments.emplace_back(ValueAsFloat(value));
+      }
+      else if (setterType == TypeId<double>())
+      {
+        setting.mArguments.emplace_back(ValueAsDouble(value));
+      }
+      else if (setterType == TypeId<i32>())
+      {
+        setting.mArguments.emplace_back(value->GetInt());
+      }
+      else if (setterType == TypeId<String>())
+      {
+        setting.mArguments.emplace_back(String{ value->GetString() });
+      }
+      else if (setterType == TypeId<std::string>())
+      {
+        setting.mArguments.emplace_back(std::string{ value->GetString() });
+      }
+      else if (setterType == TypeId<bool>())
+      {
+        setting.mArguments.emplace_back(value->GetBool());
+      }
+      else if (setterType == TypeId<glm::vec2>())
+      {
+        setting.mArguments.emplace_back(ValueAsReal2(value));
+      }
+      else if (setterType == TypeId<glm::vec3>())
+      {
+        setting.mArguments.emplace_back(ValueAsReal3(value));
+      }
+      else if (setterType == TypeId<glm::vec4>())
+      {
+        setting.mArguments.emplace_back(ValueAsReal4(value));
+      }
+      else if (setterType == TypeId<glm::quat>())
+      {
+        setting.mArguments.emplace_back(ValueAsQuaternion(value));
+      }
+      // Enums and unsupported types.
+      else
+      {
+        return false;
+      }
+
+      aRecipe.mSettings.emplace_back(std::move(setting));
+    }
+
+    return true;
+  }
+
+  void Blueprint::Instantiate(Composition *aComposition)
+  {
+    YTEProfileFunction();
+
+    for (auto type : mMissingFactories)
+    {
+      mEngine->Log(LogType::Warning,
+        fmt::format("A factory of the type named {} could not be found. \n"
+          "Perhaps it needs to be added to CoreComponentFactoryInitialization",
+          type->GetName()));
+    }
+
+    mMissingFactories.clear();
+
+    Instantiate(mRoot, aComposition);
+  }
+
+  void Blueprint::Instantiate(Node &aNode, Composition *aComposition)
+  {
+    for (auto &recipe : aNode.mComponents)
+    {
+      // Set up before it's added, as Composition::AddComponent does, so
+      // setters can't find it half done.
+      auto component = recipe.mFactory->MakeComponent(aComposition, aComposition->mSpace);
+      Apply(recipe, component.get());
+
+      aComposition->EmplaceComponent(recipe.mType, std::move(component));
+    }
+
+    if (false == aNode.mHaveDependencyOrder)
+    {
+      aNode.mDependencyOrder = YTE::GetDependencyOrder(aComposition);
+      aNode.mHaveDependencyOrder = true;
+    }
+
+    aComposition->mDependencyOrder = aNode.mDependencyOrder;
+
+    if (aComposition->mComponents.size() != aComposition->mDependencyOrder.size())
+    {
+      debugbreak();
+    }
+
+    for (auto &child : aNode.mChildren)
+    {
+      auto uniqueComposition = std::make_unique<Composition>(mEngine,
+                                                             child.mName,
+                                                             aComposition->mSpace,
+                                                             aComposition);
+      Composition *composition{ uniqueComposition.get() };
+
+      aComposition->mCompositions.Emplace(child.mName, std::move(uniqueComposition));
+
+      Instantiate(child, composition);
+    }
+
+    if (aNode.mHasArchetypeName)
+    {
+      aComposition->mArchetypeName = aNode.mArchetypeName;
+    }
+  }
+
+  void Blueprint::Apply(ComponentRecipe &aRecipe, Component *aComponent)
+  {
+    if (nullptr != aRecipe.mProperties)
+    {
+      Object::DeserializeByType(aRecipe.mProperties, aComponent, aRecipe.mType);
+      return;
+    }
+
+    for (auto &setting : aRecipe.mSettings)
+    {
+      switch (setting.mKind)
+      {
+        case Setting::Kind::Setter:
+        {
+          setting.mArguments[0].As<Object*>() = aComponent;
+          setting.mSetter->Invoke(setting.mArguments);
+          break;
+        }
+        case Setting::Kind::Redirect:
+        {
+          static_cast<RedirectObject*>(setting.mAttribute)->Deserialize(*setting.mValue, aComponent);
+          break;
+        }
+        case Setting::Kind::EditorHeader:
+        {
+          static_cast<EditorHeaderList*>(setting.mAttribute)->Deserialize(*setting.mValue, aComponent);
+          break;
+        }
+      }
+    }
+  }
+}
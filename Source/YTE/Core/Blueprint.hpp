@@ -0,0 +1,109 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#pragma once
+
+#ifndef YTE_Core_Blueprint_hpp
+#define YTE_Core_Blueprint_hpp
+
+#include <vector>
+
+#include "YTE/Core/ForwardDeclarations.hpp"
+#include "YTE/Core/Utilities.hpp"
+
+namespace YTE
+{
+  // An archetype compiled once, so spawning it doesn't walk the JSON again:
+  // component types and factories are resolved, properties are matched to
+  // their setters and their values are already converted to arguments.
+  //
+  // Points into the archetype's document for the few properties that need
+  // it (redirected objects, editor header lists, and components holding
+  // anything compiling doesn't handle, which are deserialized as before),
+  // so it must not outlive the document. See Engine::GetBlueprint.
+  //
+  // Compiling only reads shared state, so blueprints can be made on any
+  // thread, several at once (see LevelLoader). Instantiate is main thread
+  // only.
+  class Blueprint
+  {
+  public:
+    // Check IsValid, aArchetype may not have been a composition.
+    YTE_Shared Blueprint(Engine *aEngine, RSValue *aArchetype);
+
+    bool IsValid() const
+    {
+      return mValid;
+    }
+
+    // Adds the archetype's components and child compositions to
+    // aComposition, which should be empty. Doesn't initialize anything.
+    YTE_Shared void Instantiate(Composition *aComposition);
+
+  private:
+    struct Setting
+    {
+      enum class Kind
+      {
+        Setter,
+        Redirect,
+        EditorHeader
+      };
+
+      Kind mKind;
+
+      // The first argument is filled in with the object being set.
+      Function *mSetter;
+      std::vector<Any> mArguments;
+
+      Attribute *mAttribute;
+      RSValue *mValue;
+    };
+
+    struct ComponentRecipe
+    {
+      Type *mType;
+      StringComponentFactory *mFactory;
+      std::vector<Setting> mSettings;
+
+      // When something couldn't be compiled, the component's properties are
+      // deserialized from here instead of applying mSettings.
+      RSValue *mProperties;
+    };
+
+    struct Node
+    {
+      String mName;
+      std::vector<ComponentRecipe> mComponents;
+      std::vector<Node> mChildren;
+
+      // Found by the first Instantiate, the components are the same every
+      // time after.
+      std::vector<Type*> mDependencyOrder;
+      bool mHaveDependencyOrder = false;
+
+      bool mHasArchetypeName = false;
+      String mArchetypeName;
+    };
+
+    bool Compile(Node &aNode, RSValue *aValue);
+    bool CompileProperties(ComponentRecipe &aRecipe, RSValue *aProperties);
+    void Instantiate(Node &aNode, Composition *aComposition);
+    void Apply(ComponentRecipe &aRecipe, Component *aComponent);
+
+    Engine *mEngine;
+    Node mRoot;
+
+    // Components without a factory are skipped. They're reported by the
+    // first Instantiate rather than while compiling, as logging sends an
+    // event.
+    std::vector<Type*> mMissingFactories;
+
+    bool mValid;
+  };
+}
+
+#endif
@@ -5,6 +5,7 @@
 #include "YTE/Core/Composition.hpp"
 #include "YTE/Core/Component.hpp"
 #include "YTE/Core/ComponentFactory.hpp"
+#include "YTE/Core/ComponentPool.hpp"
 #include "YTE/Core/ComponentSystem.hpp"
 
 
@@ -22,7 +23,7 @@ namespace YTE
   }
 
   Component::Component(Composition *aOwner, Space *aSpace)
-    : mOwner(aOwner), mSpace(aSpace), mGUID()
+    : mOwner(aOwner), mSpace(aSpace), mGUID(), mPool(nullptr)
   {
     Engine *engine = mOwner->GetEngine();
 
@@ -47,6 +48,18 @@ namespace YTE
     mOwner->GetEngine()->RemoveComponentGUID(mGUID);
   }
 
+  void ComponentDeleter::operator()(Component *aComponent) const
+  {
+    if (nullptr != aComponent->mPool)
+    {
+      aComponent->mPool->Destroy(aComponent);
+    }
+    else
+    {
+      delete aComponent;
+    }
+  }
+
 
   RSValue Component::Serialize(RSAllocator &aAllocator)
   {
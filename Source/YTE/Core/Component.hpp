@@ -60,6 +60,14 @@ namespace YTE
     Space *mSpace;
 
     GlobalUniqueIdentifier mGUID;
+
+  private:
+    template <typename T>
+    friend class ComponentPool;
+    friend struct ComponentDeleter;
+
+    // Null if this wasn't created in a pool.
+    ComponentPoolBase *mPool;
   };
 
   class ComponentDependencies : public Attribute
@@ -13,6 +13,7 @@
 
 #include <memory>
 
+#include "YTE/Core/ComponentPool.hpp"
 #include "YTE/Core/EventHandler.hpp"
 
 #include "YTE/Core/ForwardDeclarations.hpp"
@@ -23,8 +24,8 @@ namespace YTE
   class StringComponentFactory : public EventHandler
   {
   public:
-    virtual UniquePointer<Component> MakeComponent(Composition *aOwner,
-                                                   Space *aSpace) = 0;
+    virtual UniquePointer<Component, ComponentDeleter> MakeComponent(Composition *aOwner,
+                                                                     Space *aSpace) = 0;
 
     StringComponentFactory(Engine *aEngine) : mEngine(aEngine) {};
 
@@ -38,13 +39,18 @@ namespace YTE
   class ComponentFactory : public StringComponentFactory
   {
   public:
-    UniquePointer<Component> MakeComponent(Composition *aOwner, Space *aSpace) override
+    UniquePointer<Component, ComponentDeleter> MakeComponent(Composition *aOwner, Space *aSpace) override
     {
-      return std::make_unique<T>(aOwner, aSpace);
+      return mPool.Create(aOwner, aSpace);
     }
+
+    ComponentPool<T>& GetPool() { return mPool; }
   
     ComponentFactory(Engine *aEngine) : StringComponentFactory(aEngine) {};
     virtual ~ComponentFactory() { };
+
+  private:
+    ComponentPool<T> mPool;
   };
 }
 
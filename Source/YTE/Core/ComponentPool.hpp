@@ -0,0 +1,82 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#pragma once
+
+#ifndef YTE_Core_ComponentPool_hpp
+#define YTE_Core_ComponentPool_hpp
+
+#include <utility>
+
+#include "YTE/Core/Component.hpp"
+#include "YTE/Core/Utilities.hpp"
+
+#include "YTE/StandardLibrary/SlabAllocator.hpp"
+
+namespace YTE
+{
+  class ComponentPoolBase
+  {
+  public:
+    virtual ~ComponentPoolBase() {};
+
+    virtual void Destroy(Component *aComponent) = 0;
+  };
+
+  // Where every component of exactly one type is created, packed into
+  // chunks so systems can walk all of them in memory order instead of
+  // walking the composition tree. Owned by the type's ComponentFactory, so
+  // it lives as long as the ComponentSystem does, components are handed
+  // back through ComponentDeleter.
+  template <typename tComponentType>
+  class ComponentPool : public ComponentPoolBase
+  {
+  public:
+    static constexpr size_t cComponentsPerChunk = 64;
+
+    template <typename... tArguments>
+    UniquePointer<Component, ComponentDeleter> Create(tArguments &&...aArguments)
+    {
+      tComponentType *component = mComponents.Create(std::forward<tArguments>(aArguments)...);
+      component->mPool = this;
+
+      return UniquePointer<Component, ComponentDeleter>(component);
+    }
+
+    void Destroy(Component *aComponent) override
+    {
+      mComponents.Destroy(static_cast<tComponentType*>(aComponent));
+    }
+
+    size_t size() const
+    {
+      return mComponents.size();
+    }
+
+    // Every component in the pool, across every space.
+    template <typename tFunction>
+    void ForEach(tFunction &&aFunction)
+    {
+      mComponents.ForEach(aFunction);
+    }
+
+    size_t GetChunkCount() const
+    {
+      return mComponents.GetChunkCount();
+    }
+
+    template <typename tFunction>
+    void ForEachInChunk(size_t aChunk, tFunction &&aFunction)
+    {
+      mComponents.ForEachInChunk(aChunk, aFunction);
+    }
+
+  private:
+    SlabAllocator<tComponentType, cComponentsPerChunk> mComponents;
+  };
+}
+
+#endif
@@ -0,0 +1,77 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#include "YTE/Core/ComponentRegistry.hpp"
+
+namespace YTE
+{
+  std::vector<Component*> const& ComponentRegistry::Track(Type *aType,
+                                                          std::vector<Component*> aComponents)
+  {
+    auto &tracked = mTypes[aType];
+    tracked.mComponents = std::move(aComponents);
+    tracked.mIndices.clear();
+
+    for (size_t i = 0; i < tracked.mComponents.size(); ++i)
+    {
+      tracked.mIndices.emplace(tracked.mComponents[i], i);
+    }
+
+    return tracked.mComponents;
+  }
+
+  void ComponentRegistry::Add(Type *aType, Component *aComponent)
+  {
+    if (mTypes.empty())
+    {
+      return;
+    }
+
+    auto iterator = mTypes.find(aType);
+
+    if (iterator == mTypes.end())
+    {
+      return;
+    }
+
+    auto &tracked = iterator->second;
+
+    if (tracked.mIndices.emplace(aComponent, tracked.mComponents.size()).second)
+    {
+      tracked.mComponents.emplace_back(aComponent);
+    }
+  }
+
+  void ComponentRegistry::Remove(Type *aType, Component *aComponent)
+  {
+    if (mTypes.empty())
+    {
+      return;
+    }
+
+    auto iterator = mTypes.find(aType);
+
+    if (iterator == mTypes.end())
+    {
+      return;
+    }
+
+    auto &tracked = iterator->second;
+    auto index = tracked.mIndices.find(aComponent);
+
+    if (index == tracked.mIndices.end())
+    {
+      return;
+    }
+
+    auto last = tracked.mComponents.back();
+    tracked.mComponents[index->second] = last;
+    tracked.mIndices[last] = index->second;
+
+    tracked.mComponents.pop_back();
+    tracked.mIndices.erase(aComponent);
+  }
+}
@@ -0,0 +1,62 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#pragma once
+
+#ifndef YTE_Core_ComponentRegistry_hpp
+#define YTE_Core_ComponentRegistry_hpp
+
+#include <unordered_map>
+#include <vector>
+
+#include "YTE/Core/Utilities.hpp"
+
+namespace YTE
+{
+  // The components of chosen types in one Space, kept up to date as they're
+  // added and removed, so finding them is as cheap as the result is long
+  // rather than a walk of the whole tree. Types are only tracked once
+  // someone asks for them, see Space::GetTrackedComponents.
+  class ComponentRegistry
+  {
+  public:
+    // Null if aType isn't tracked.
+    std::vector<Component*> const* Find(Type *aType) const
+    {
+      auto iterator = mTypes.find(aType);
+
+      if (iterator == mTypes.end())
+      {
+        return nullptr;
+      }
+
+      return &iterator->second.mComponents;
+    }
+
+    // Starts tracking aType, aComponents must be every component of it that
+    // currently exists.
+    YTE_Shared std::vector<Component*> const& Track(Type *aType,
+                                                    std::vector<Component*> aComponents);
+
+    // Both ignore types that aren't tracked, aType is the component's key
+    // in its Composition.
+    YTE_Shared void Add(Type *aType, Component *aComponent);
+    YTE_Shared void Remove(Type *aType, Component *aComponent);
+
+  private:
+    struct Tracked
+    {
+      std::vector<Component*> mComponents;
+
+      // Where each component sits in mComponents, so removing is a swap.
+      std::unordered_map<Component*, size_t> mIndices;
+    };
+
+    std::unordered_map<Type*, Tracked> mTypes;
+  };
+}
+
+#endif
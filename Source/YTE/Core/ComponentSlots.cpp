@@ -0,0 +1,167 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+#include "YTE/Core/Component.hpp"
+#include "YTE/Core/ComponentSlots.hpp"
+
+namespace YTE
+{
+  namespace
+  {
+    struct Registry
+    {
+      std::mutex mLock;
+      std::unordered_map<Type*, ComponentTypeIndex::Entry*> mByType;
+
+      // A deque so entries never move as more are added.
+      std::deque<ComponentTypeIndex::Entry> mEntries;
+    };
+
+    Registry& GetRegistry()
+    {
+      static Registry registry;
+      return registry;
+    }
+
+    // Bases are registered first, so they always have lower indices.
+    ComponentTypeIndex::Entry& GetLocked(Registry &aRegistry, Type *aType)
+    {
+      auto iterator = aRegistry.mByType.find(aType);
+
+      if (iterator != aRegistry.mByType.end())
+      {
+        return *iterator->second;
+      }
+
+      ComponentTypeIndex::Entry *baseEntry = nullptr;
+      auto base = aType->GetBaseType();
+
+      if (nullptr != base && TypeId<Component>() != base)
+      {
+        baseEntry = &GetLocked(aRegistry, base);
+      }
+
+      auto &entry = aRegistry.mEntries.emplace_back();
+      entry.mType = aType;
+      entry.mIndex = aRegistry.mEntries.size() - 1;
+      entry.mLineage.emplace_back(entry.mIndex);
+
+      if (nullptr != baseEntry)
+      {
+        entry.mLineage.insert(entry.mLineage.end(),
+                              baseEntry->mLineage.begin(),
+                              baseEntry->mLineage.end());
+      }
+
+      aRegistry.mByType.emplace(aType, &entry);
+      return entry;
+    }
+  }
+
+  ComponentTypeIndex::Entry const& ComponentTypeIndex::Get(Type *aType)
+  {
+    auto &registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mLock);
+
+    return GetLocked(registry, aType);
+  }
+
+  Type* ComponentTypeIndex::GetType(size_t aIndex)
+  {
+    auto &registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mLock);
+
+    return registry.mEntries[aIndex].mType;
+  }
+
+  void ComponentTypeIndex::Retire(Type *aType)
+  {
+    auto &registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mLock);
+
+    auto iterator = registry.mByType.find(aType);
+
+    if (iterator != registry.mByType.end())
+    {
+      iterator->second->mType = nullptr;
+      registry.mByType.erase(iterator);
+    }
+  }
+
+  void ComponentSlots::Add(Type *aType, Component *aComponent)
+  {
+    auto &entry = ComponentTypeIndex::Get(aType);
+
+    for (auto index : entry.mLineage)
+    {
+      if (mSlots.size() <= index)
+      {
+        mSlots.resize(index + 1);
+      }
+
+      auto &slot = mSlots[index];
+
+      // An exact match displaces a derived component, but never the reverse.
+      if (index == entry.mIndex || nullptr == slot.mComponent)
+      {
+        slot.mComponent = aComponent;
+        slot.mType = aType;
+      }
+    }
+  }
+
+  void ComponentSlots::Remove(Component *aComponent, ComponentMap const &aComponents)
+  {
+    for (size_t i = 0; i < mSlots.size(); ++i)
+    {
+      auto &slot = mSlots[i];
+
+      if (aComponent != slot.mComponent)
+      {
+        continue;
+      }
+
+      slot = Slot{};
+
+      auto slotType = ComponentTypeIndex::GetType(i);
+
+      if (nullptr == slotType)
+      {
+        continue;
+      }
+
+      for (auto const& [type, component] : aComponents)
+      {
+        if (aComponent == component.get())
+        {
+          continue;
+        }
+
+        if (slotType == type)
+        {
+          slot.mComponent = component.get();
+          slot.mType = type;
+          break;
+        }
+
+        if (nullptr == slot.mComponent && type->IsA(slotType))
+        {
+          slot.mComponent = component.get();
+          slot.mType = type;
+        }
+      }
+    }
+
+    while (false == mSlots.empty() && nullptr == mSlots.back().mComponent)
+    {
+      mSlots.pop_back();
+    }
+  }
+}
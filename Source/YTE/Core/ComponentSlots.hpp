@@ -0,0 +1,104 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#pragma once
+
+#ifndef YTE_Core_ComponentSlots_hpp
+#define YTE_Core_ComponentSlots_hpp
+
+#include <cstddef>
+#include <vector>
+
+#include "YTE/Core/Utilities.hpp"
+
+namespace YTE
+{
+  // Dense indices for component types, handed out the first time a type is
+  // added to or looked up on a Composition. Registering a type registers its
+  // bases too, up to (but not including) Component.
+  class ComponentTypeIndex
+  {
+  public:
+    struct Entry
+    {
+      Type *mType;
+      size_t mIndex;
+
+      // This type's index followed by each of its bases'.
+      std::vector<size_t> mLineage;
+    };
+
+    // Entries are never moved or freed, so the reference is good forever.
+    YTE_Shared static Entry const& Get(Type *aType);
+
+    template <typename tComponentType>
+    static size_t Get()
+    {
+      static size_t const index = Get(TypeId<tComponentType>()).mIndex;
+      return index;
+    }
+
+    // Null if the type has been retired.
+    YTE_Shared static Type* GetType(size_t aIndex);
+
+    // For when a type is replaced (see BoundTypeChanged), so its address can
+    // be reused by a new type without inheriting its index. The index isn't
+    // reused.
+    YTE_Shared static void Retire(Type *aType);
+  };
+
+  // Per Composition table from component type index to its component, so
+  // GetComponent and GetDerivedComponent are an index rather than a search.
+  // A slot holds the component of exactly that type if there is one,
+  // otherwise one that derives from it.
+  class ComponentSlots
+  {
+  public:
+    // The component keyed by aType, not one derived from it.
+    Component* GetExact(size_t aIndex, Type *aType) const
+    {
+      if (aIndex < mSlots.size() && aType == mSlots[aIndex].mType)
+      {
+        return mSlots[aIndex].mComponent;
+      }
+
+      return nullptr;
+    }
+
+    Component* GetDerived(size_t aIndex) const
+    {
+      if (aIndex < mSlots.size())
+      {
+        return mSlots[aIndex].mComponent;
+      }
+
+      return nullptr;
+    }
+
+    // aType is the key aComponent is stored under.
+    YTE_Shared void Add(Type *aType, Component *aComponent);
+
+    // Call before aComponent leaves aComponents, slots it was in are refilled
+    // from the rest of aComponents.
+    YTE_Shared void Remove(Component *aComponent, ComponentMap const &aComponents);
+
+    void Clear()
+    {
+      mSlots.clear();
+    }
+
+  private:
+    struct Slot
+    {
+      Component *mComponent = nullptr;
+      Type *mType = nullptr;
+    };
+
+    std::vector<Slot> mSlots;
+  };
+}
+
+#endif
@@ -6,6 +6,7 @@
 * \copyright All content 2016 DigiPen (USA) Corporation, all rights reserved.
 */
 /******************************************************************************/
+#include "YTE/Core/ComponentSlots.hpp"
 #include "YTE/Core/ComponentSystem.hpp"
 #include "YTE/Core/Component.hpp"
 #include "YTE/Core/CoreComponentFactoryInitilization.hpp"
@@ -31,6 +32,9 @@ namespace YTE
 
   void ComponentSystem::BoundTypeChangedHandler(BoundTypeChanged *aEvent)
   {
+    ComponentTypeIndex::Retire(aEvent->aOldType);
+    ClearDependencyOrderCache();
+
     auto iterator = mComponentFactories.Find(aEvent->aOldType);
 
     if (iterator != mComponentFactories.end())
@@ -47,7 +51,7 @@ namespace YTE
     }
   }
     
-  std::pair<StringComponentFactory *, UniquePointer<Component>>
+  std::pair<StringComponentFactory *, UniquePointer<Component, ComponentDeleter>>
     ComponentSystem::MakeComponent(BoundType *aType, Composition *aOwner)
   {
     auto it = mComponentFactories.Find(aType);
@@ -36,7 +36,7 @@ namespace YTE
     void FactorySetup(FactorySetupCallback aFunctionPtr);
     void BoundTypeChangedHandler(BoundTypeChanged *aEvent);
 
-    std::pair<StringComponentFactory *, UniquePointer<Component>> 
+    std::pair<StringComponentFactory *, UniquePointer<Component, ComponentDeleter>> 
       MakeComponent(BoundType *aType, Composition *aOwner);
 
     template<typename T>
@@ -51,6 +51,21 @@ namespace YTE
 
       return nullptr;
     }
+
+    // Where every component of exactly type T is stored, null if T has no
+    // factory.
+    template<typename T>
+    ComponentPool<T>* GetComponentPool()
+    {
+      auto factory = GetComponentFactory<T>();
+
+      if (nullptr != factory)
+      {
+        return &factory->GetPool();
+      }
+
+      return nullptr;
+    }
       
     StringComponentFactory* GetComponentFactory(BoundType *aType)
     {
@@ -1,4 +1,7 @@
+#include <algorithm>
+#include <mutex>
 #include <stack>
+#include <unordered_map>
 
 #include "fmt/format.h"
 
@@ -20,8 +23,6 @@
 
 namespace YTE
 {
-  std::vector<Type*> GetDependencyOrder(Composition *aComposition);
-
   YTEDefineEvent(AssetInitialize);
   YTEDefineEvent(NativeInitialize);
   YTEDefineEvent(PhysicsInitialize);
@@ -194,6 +195,7 @@ namespace YTE
       auto component = mComponents.Find(*typeIt);
       if (component != mComponents.end())
       {
+        UnindexComponent(component->first, component->second.get());
         mComponents.Erase(component);
       }
     }
@@ -207,12 +209,16 @@ namespace YTE
 
     if (iterator != mComponents.end())
     {
+      auto component = iterator->second.get();
+
+      UnindexComponent(aEvent->aOldType, component);
       mComponents.ChangeKey(iterator, aEvent->aNewType);
+      IndexComponent(aEvent->aNewType, component);
     }
   }
 
   template <auto tMemberFunction>
-  void HandleInitialization(std::string const& aEventName,
+  void HandleInitialization(EventId aEventName,
                             InitializeEvent* aEvent,
                             Composition* aComposition)
   {
@@ -416,6 +422,26 @@ namespace YTE
   {
     YTEProfileFunction();
 
+    auto blueprint = mEngine->GetBlueprint(aArchetype);
+    RSValue *archetype = nullptr;
+
+    if (nullptr == blueprint)
+    {
+      archetype = mEngine->GetArchetype(aArchetype);
+
+      // A missing archetype reads as an empty document, a broken one stops at
+      // the parse error, either way there's nothing to build from.
+      if (false == archetype->IsObject())
+      {
+        mEngine->Log(LogType::Warning,
+          fmt::format("Couldn't add {}, the archetype {} is missing or couldn't be parsed.",
+            aObjectName,
+            aArchetype));
+
+        return nullptr;
+      }
+    }
+
     // If a Composition is just below the Space, we currently guarantee their mOwner is
     // nullptr.
     auto owner = this;
@@ -425,12 +451,23 @@ namespace YTE
       owner = nullptr;
     }
 
-    Composition *comp = AddCompositionInternal(std::make_unique<Composition>(mEngine,
-                                                                             aObjectName,
-                                                                             mSpace,
-                                                                             owner),
-                                               mEngine->GetArchetype(aArchetype),
-                                               aObjectName);
+    auto uniqueComposition = std::make_unique<Composition>(mEngine,
+                                                           aObjectName,
+                                                           mSpace,
+                                                           owner);
+    Composition *comp;
+
+    if (blueprint)
+    {
+      comp = mCompositions.Emplace(aObjectName, std::move(uniqueComposition))->second.get();
+      blueprint->Instantiate(comp);
+    }
+    else
+    {
+      comp = AddCompositionInternal(std::move(uniqueComposition),
+                                    archetype,
+                                    aObjectName);
+    }
 
     comp->SetArchetypeName(aArchetype);
 
@@ -481,6 +518,26 @@ namespace YTE
   {
     YTEProfileFunction();
 
+    auto blueprint = mEngine->GetBlueprint(aArchetype);
+    RSValue *archetype = nullptr;
+
+    if (nullptr == blueprint)
+    {
+      archetype = mEngine->GetArchetype(aArchetype);
+
+      // A missing archetype reads as an empty document, a broken one stops at
+      // the parse error, either way there's nothing to build from.
+      if (false == archetype->IsObject())
+      {
+        mEngine->Log(LogType::Warning,
+          fmt::format("Couldn't add {}, the archetype {} is missing or couldn't be parsed.",
+            aObjectName,
+            aArchetype));
+
+        return nullptr;
+      }
+    }
+
     // If a Composition is just below the Space, we currently guarantee their mOwner is
     // nullptr.
     auto owner = this;
@@ -528,10 +585,9 @@ namespace YTE
       composition->PhysicsInitialize(&event);
       composition->Initialize(&event);
       composition->Start(&event);
+      composition->SetArchetypeName(aArchetype);
     }
 
-    composition->SetArchetypeName(aArchetype);
-
     return composition;
   }
 
@@ -566,48 +622,130 @@ namespace YTE
     return composition;
   }
 
-  void Composition::Deserialize(RSValue *aValue)
+  std::vector<Composition*> Composition::AddCompositions(String aArchetype,
+                                                        String aObjectName,
+                                                        size_t aCount)
+  {
+    return AddCompositionsInternal(aArchetype, aObjectName, aCount, nullptr);
+  }
+
+  std::vector<Composition*> Composition::AddCompositions(String aArchetype,
+                                                        String aObjectName,
+                                                        std::vector<glm::vec3> const& aPositions)
+  {
+    return AddCompositionsInternal(aArchetype, aObjectName, aPositions.size(), aPositions.data());
+  }
+
+  std::vector<Composition*> Composition::AddCompositionsInternal(String &aArchetype,
+                                                                String &aObjectName,
+                                                                size_t aCount,
+                                                                glm::vec3 const *aPositions)
   {
     YTEProfileFunction();
 
-    RSStringBuffer buffer;
-    RSPrettyWriter writer(buffer);
-    aValue->Accept(writer);
-    std::string json = buffer.GetString();
-
-    // Annoyingly warn on debug.
-    DebugObjection(false == aValue->IsObject(), "We're trying to serialize something that isn't a composition.");
-    DebugObjection(false == aValue->HasMember("Compositions") || 
-                false == (*aValue)["Compositions"].IsObject(), 
-                "We're trying to serialize something without Compositions: \n%s",
-                json.c_str());
-    DebugObjection(false == aValue->HasMember("Components") ||
-                false == (*aValue)["Components"].IsObject(), 
-                "We're trying to serialize something without Components: \n%s",
-                json.c_str());
-
-    // On release just exit out on these errors.
-    if (false == aValue->IsObject())
-    {
-      printf("We're trying to serialize something that isn't a composition: \n%s",
-             json.c_str());
-      return;
+    std::vector<Composition*> compositions;
+    compositions.reserve(aCount);
+
+    for (size_t i = 0; i < aCount; ++i)
+    {
+      auto composition = AddCompositionInternal(aArchetype, aObjectName);
+
+      // The archetype is broken, the rest would be too.
+      if (nullptr == composition)
+      {
+        break;
+      }
+
+      compositions.emplace_back(composition);
     }
 
-    if (false == aValue->HasMember("Compositions") ||
-        false == (*aValue)["Compositions"].IsObject())
+    InitializeEvent event;
+
+    for (auto composition : compositions)
     {
-      printf("We're trying to serialize something without Compositions: \n%s",
-             json.c_str());
-      return;
+      composition->AssetInitialize(&event);
+    }
+
+    for (auto composition : compositions)
+    {
+      composition->NativeInitialize(&event);
+    }
+
+    for (auto composition : compositions)
+    {
+      composition->PhysicsInitialize(&event);
+    }
+
+    if (nullptr != aPositions)
+    {
+      for (size_t i = 0; i < compositions.size(); ++i)
+      {
+        if (auto transform = compositions[i]->GetComponent<Transform>())
+        {
+          transform->SetTranslation(aPositions[i]);
+        }
+      }
+    }
+
+    for (auto composition : compositions)
+    {
+      composition->Initialize(&event);
     }
 
+    for (auto composition : compositions)
+    {
+      composition->Start(&event);
+    }
+
+    return compositions;
+  }
 
-    if (false == aValue->HasMember("Components") ||
-        false == (*aValue)["Components"].IsObject())
+  void Composition::Deserialize(RSValue *aValue)
+  {
+    YTEProfileFunction();
+
+    bool isObject = aValue->IsObject();
+    bool hasCompositions = isObject &&
+                           aValue->HasMember("Compositions") &&
+                           (*aValue)["Compositions"].IsObject();
+    bool hasComponents = isObject &&
+                         aValue->HasMember("Components") &&
+                         (*aValue)["Components"].IsObject();
+
+    if (false == isObject || false == hasCompositions || false == hasComponents)
     {
-      printf("We're trying to serialize something without Components: \n%s",
-             json.c_str());
+      // Only printed out when we need it, it's a lot of work for big levels.
+      RSStringBuffer buffer;
+      RSPrettyWriter writer(buffer);
+      aValue->Accept(writer);
+      std::string json = buffer.GetString();
+
+      // Annoyingly warn on debug.
+      DebugObjection(false == isObject, "We're trying to serialize something that isn't a composition.");
+      DebugObjection(isObject && false == hasCompositions,
+                     "We're trying to serialize something without Compositions: \n%s",
+                     json.c_str());
+      DebugObjection(isObject && false == hasComponents,
+                     "We're trying to serialize something without Components: \n%s",
+                     json.c_str());
+
+      // On release just exit out on these errors.
+      if (false == isObject)
+      {
+        printf("We're trying to serialize something that isn't a composition: \n%s",
+               json.c_str());
+      }
+      else if (false == hasCompositions)
+      {
+        printf("We're trying to serialize something without Compositions: \n%s",
+               json.c_str());
+      }
+      else
+      {
+        printf("We're trying to serialize something without Components: \n%s",
+               json.c_str());
+      }
+
       return;
     }
 
@@ -623,13 +761,44 @@ namespace YTE
       AddComponent(componentType, &componentIt->value);
     }
 
+    OrderComponents();
+
+    auto &compositions = (*aValue)["Compositions"];
+
+    for (auto compositionIt = compositions.MemberBegin();
+         compositionIt < compositions.MemberEnd();
+         ++compositionIt)
+    {
+      DeserializeChild(compositionIt->name.GetString(), &compositionIt->value);
+    }
+
+    if (aValue->HasMember("Archetype"))
+    {
+        mArchetypeName = (*aValue)["Archetype"].GetString();
+    }
+  }
+
+  void Composition::OrderComponents()
+  {
     mDependencyOrder = YTE::GetDependencyOrder(this);
 
     if (mComponents.size() != mDependencyOrder.size())
     {
       debugbreak();
     }
+  }
+
+  Composition* Composition::DeserializeChild(String const &aName, RSValue *aValue)
+  {
+    Composition *composition = EmplaceChild(aName);
+
+    composition->Deserialize(aValue);
+
+    return composition;
+  }
 
+  Composition* Composition::EmplaceChild(String const &aName)
+  {
     // If a Composition is just below the Space, we currently guarantee their mOwner is
     // nullptr.
     auto owner = this;
@@ -639,29 +808,15 @@ namespace YTE
       owner = nullptr;
     }
 
-    auto &compositions = (*aValue)["Compositions"];
-
-    for (auto compositionIt = compositions.MemberBegin();
-         compositionIt < compositions.MemberEnd();
-         ++compositionIt)
-    {
-      String compositionName = compositionIt->name.GetString();
-
-      auto uniqueComposition = std::make_unique<Composition>(mEngine,
-                                                             compositionName,
-                                                             mSpace,
-                                                             owner);
-      Composition *composition{ uniqueComposition.get() };
+    auto uniqueComposition = std::make_unique<Composition>(mEngine,
+                                                           aName,
+                                                           mSpace,
+                                                           owner);
+    Composition *composition{ uniqueComposition.get() };
 
-      mCompositions.Emplace(compositionName, std::move(uniqueComposition));
-
-      composition->Deserialize(&compositionIt->value);
-    }
+    mCompositions.Emplace(aName, std::move(uniqueComposition));
 
-    if (aValue->HasMember("Archetype"))
-    {
-        mArchetypeName = (*aValue)["Archetype"].GetString();
-    }
+    return composition;
   }
 
   RSValue Composition::Serialize(RSAllocator &aAllocator)
@@ -845,50 +1000,127 @@ namespace YTE
     }
   };
 
-  std::vector<Type*> GetDependencyOrder(Composition *aComposition)
+  namespace
   {
-    YTEProfileFunction();
+    // Which components a composition has is all that decides their order, so
+    // it's sorted once per distinct set of types and shared by every
+    // composition with that set.
+    struct TypeSetHash
+    {
+      size_t operator()(std::vector<Type*> const& aTypes) const
+      {
+        size_t hash = aTypes.size();
 
-    Graph dependencyGraph;
+        for (auto type : aTypes)
+        {
+          hash ^= std::hash<Type*>()(type) + 0x9E3779B9 + (hash << 6) + (hash >> 2);
+        }
 
-    for (auto const& [type, component] : aComposition->GetComponents())
+        return hash;
+      }
+    };
+
+    struct DependencyOrderCache
     {
-      // Might not have dependencies, so we add the vertex first just in case.
-      dependencyGraph.AddVertex(type);
+      std::mutex mLock;
+      std::unordered_map<std::vector<Type*>, std::vector<Type*>, TypeSetHash> mOrders;
+    };
 
-      auto dependencies = type->GetAttribute<ComponentDependencies>();
-    
-      if (dependencies)
+    DependencyOrderCache& GetDependencyOrderCache()
+    {
+      static DependencyOrderCache cache;
+      return cache;
+    }
+
+    // aTypes must be sorted.
+    std::vector<Type*> SortByDependencies(std::vector<Type*> const& aTypes)
+    {
+      Graph dependencyGraph;
+
+      for (auto type : aTypes)
       {
-        // Each element of mTypes here represents a vector in which at least
-        // one type must be satisfied.
-        for (auto const& dependencyOrs : dependencies->mTypes)
-        {
-          bool foundOne = false;
+        // Might not have dependencies, so we add the vertex first just in case.
+        dependencyGraph.AddVertex(type);
 
-          for (auto dependencyOr : dependencyOrs)
+        auto dependencies = type->GetAttribute<ComponentDependencies>();
+    
+        if (dependencies)
+        {
+          // Each element of mTypes here represents a vector in which at least
+          // one type must be satisfied.
+          for (auto const& dependencyOrs : dependencies->mTypes)
           {
-            if (aComposition->GetComponent(dependencyOr))
+            bool foundOne = false;
+
+            for (auto dependencyOr : dependencyOrs)
             {
-              // We've found a match, we no longer need to search
-              // this OR list.
-              dependencyGraph.AddEdge(type, dependencyOr);
-              foundOne = true;
-              break;
+              if (std::binary_search(aTypes.begin(), aTypes.end(), dependencyOr))
+              {
+                // We've found a match, we no longer need to search
+                // this OR list.
+                dependencyGraph.AddEdge(type, dependencyOr);
+                foundOne = true;
+                break;
+              }
             }
-          }
 
-          // We didn't find a satisfactory dependency, early out.
-          if (false == foundOne)
-          {
-            // Prefer to return an empty vector for failure;
-            return {};
+            // We didn't find a satisfactory dependency, early out.
+            if (false == foundOne)
+            {
+              // Prefer to return an empty vector for failure;
+              return {};
+            }
           }
         }
       }
+
+      return std::move(dependencyGraph.TopologicalSort());
     }
+  }
 
-    return std::move(dependencyGraph.TopologicalSort());
+  std::vector<Type*> GetDependencyOrder(Composition *aComposition)
+  {
+    YTEProfileFunction();
+
+    thread_local std::vector<Type*> types;
+    types.clear();
+
+    for (auto const& [type, component] : aComposition->GetComponents())
+    {
+      types.emplace_back(type);
+    }
+
+    std::sort(types.begin(), types.end());
+
+    auto &cache = GetDependencyOrderCache();
+
+    {
+      std::lock_guard<std::mutex> lock(cache.mLock);
+
+      auto iterator = cache.mOrders.find(types);
+
+      if (iterator != cache.mOrders.end())
+      {
+        return iterator->second;
+      }
+    }
+
+    // Sorted outside the lock, if another thread gets there first with the
+    // same set they'll have found the same order.
+    auto order = SortByDependencies(types);
+
+    std::lock_guard<std::mutex> lock(cache.mLock);
+    cache.mOrders.emplace(types, order);
+
+    return order;
+  }
+
+  void ClearDependencyOrderCache()
+  {
+    auto &cache = GetDependencyOrderCache();
+
+    std::lock_guard<std::mutex> lock(cache.mLock);
+    cache.mOrders.clear();
   }
 
 
@@ -1022,17 +1254,7 @@ namespace YTE
   {
     YTEProfileFunction();
 
-    auto componentType = TypeId<Component>();
-
-    for (auto const&[type, component] : mComponents)
-    {
-      if (type->IsA(aType, componentType))
-      {
-        return component.get();
-      }
-    }
-
-    return nullptr;
+    return mComponentSlots.GetDerived(ComponentTypeIndex::Get(aType).mIndex);
   }
 
   Component* Composition::AddComponent(BoundType *aType, bool aCheckRunInEditor)
@@ -1097,7 +1319,7 @@ namespace YTE
 
         DeserializeByType(aProperties, toReturn, aType);
 
-        mComponents.Emplace(aType, std::move(component));
+        EmplaceComponent(aType, std::move(component));
       }
       else
       {
@@ -1164,7 +1386,8 @@ namespace YTE
     if (iter != range.end()) 
     {
       auto unique_this = std::move(iter->second);
-      parent->RemoveCompositionInternal(iter);
+      CompositionMap::iterator toRemove{ iter };
+      parent->RemoveCompositionInternal(toRemove);
       aNewParent->AddCompositionInternal(std::move(unique_this), nullptr, mName);
 
       ParentChanged event;
@@ -1237,9 +1460,40 @@ namespace YTE
 
   void  Composition::RemoveComponentInternal(ComponentMap::iterator &aComponent)
   {
+    UnindexComponent(aComponent->first, aComponent->second.get());
     mComponents.Erase(aComponent);
   }
 
+  Component* Composition::EmplaceComponent(Type *aType, UniquePointer<Component, ComponentDeleter> aComponent)
+  {
+    auto component = aComponent.get();
+
+    mComponents.Emplace(aType, std::move(aComponent));
+    IndexComponent(aType, component);
+
+    return component;
+  }
+
+  void Composition::IndexComponent(Type *aType, Component *aComponent)
+  {
+    mComponentSlots.Add(aType, aComponent);
+
+    if (nullptr != mSpace)
+    {
+      mSpace->GetComponentRegistry().Add(aType, aComponent);
+    }
+  }
+
+  void Composition::UnindexComponent(Type *aType, Component *aComponent)
+  {
+    mComponentSlots.Remove(aComponent, mComponents);
+
+    if (nullptr != mSpace)
+    {
+      mSpace->GetComponentRegistry().Remove(aType, aComponent);
+    }
+  }
+
   void Composition::RemoveComponent(BoundType *aComponent)
   {
     YTEProfileFunction();
@@ -1290,7 +1544,7 @@ namespace YTE
 
     auto range = compositionMap.FindAll(mName);
     
-    for (auto it = range.begin(); it < range.end(); ++it)
+    for (auto it = range.begin(); it != range.end(); ++it)
     {
       if (this == it->second.get())
       {
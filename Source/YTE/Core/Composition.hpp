@@ -21,6 +21,7 @@ All content (c) 2016 DigiPen  (USA) Corporation, all rights reserved.
 #include <memory>
 #include <set>
 
+#include "YTE/Core/ComponentSlots.hpp"
 #include "YTE/Core/ComponentSystem.hpp"
 #include "YTE/Core/EventHandler.hpp"
 #include "YTE/Core/ForwardDeclarations.hpp"
@@ -79,6 +80,15 @@ namespace YTE
     Composition* mNewParent;
   };
 
+  // The order aComposition's components need to be initialized in so each
+  // comes after those it depends on, empty if a dependency is missing.
+  // Remembered for each distinct set of component types.
+  YTE_Shared std::vector<Type*> GetDependencyOrder(Composition *aComposition);
+
+  // For when types are replaced (see BoundTypeChanged), so orders aren't
+  // found for sets holding the old types.
+  YTE_Shared void ClearDependencyOrderCache();
+
   class Composition : public EventHandler
   {
   public:
@@ -130,9 +140,20 @@ namespace YTE
       return result;
     }
 
+    // Null (and nothing is added) if the archetype is missing or broken.
     YTE_Shared Composition* AddComposition(String aArchetype, String aObjectName);
     YTE_Shared Composition* AddComposition(RSValue* aArchetype, String aObjectName);
     YTE_Shared Composition* AddCompositionAtPosition(String archetype, String aObjectName, glm::vec3 aPosition);
+
+    // Adds aCount (or one per position) compositions of the archetype, each
+    // initialization phase running over all of them before the next. Empty if
+    // the archetype is missing or broken.
+    YTE_Shared std::vector<Composition*> AddCompositions(String aArchetype, 
+                                                         String aObjectName, 
+                                                         size_t aCount);
+    YTE_Shared std::vector<Composition*> AddCompositions(String aArchetype,
+                                                         String aObjectName,
+                                                         std::vector<glm::vec3> const& aPositions);
     inline CompositionMap& GetCompositions() { return mCompositions; };
 
     YTE_Shared void Remove();
@@ -144,14 +165,11 @@ namespace YTE
       static_assert(std::is_base_of<Component, tComponentType>() &&
                     !std::is_same<Component, tComponentType>(),
                     "Type must be derived from YTE::Component");
-      auto iterator = mComponents.Find(TypeId<tComponentType>());
 
-      if (iterator == mComponents.end())
-      {
-        return nullptr;
-      }
+      auto component = mComponentSlots.GetExact(ComponentTypeIndex::Get<tComponentType>(),
+                                                TypeId<tComponentType>());
 
-      return static_cast<tComponentType*>(iterator->second.get());
+      return static_cast<tComponentType*>(component);
     }
 
     YTE_Shared void RemoveComponent(Component* aComponent);
@@ -166,28 +184,38 @@ namespace YTE
     // Gets all Components of the given type that are part of or childed to this composition.
     template <typename ComponentType>
     std::vector<ComponentType*> GetComponents()
+    {
+      std::vector<ComponentType*> components;
+
+      ForEachComponent<ComponentType>([&components](ComponentType *aComponent)
+      {
+        components.emplace_back(aComponent);
+      });
+
+      return components;
+    }
+
+    // Calls aFunction with every Component of the given type that is part of
+    // or childed to this composition, in the same order as GetComponents but
+    // without building any lists. Don't add or remove compositions while
+    // visiting.
+    template <typename ComponentType, typename tFunction>
+    void ForEachComponent(tFunction &&aFunction)
     {
       static_assert(std::is_base_of<Component, ComponentType>() &&
                     !std::is_same<Component, ComponentType>());
-      // This function traverses all compositions and retrieves
-      // all the components of the templated type.
-      std::vector<ComponentType*> components;
 
       for (auto const& [name, composition] : mCompositions)
       {
-        auto moreComponents = composition->GetComponents<ComponentType>();
-
-        components.insert(components.end(), moreComponents.begin(), moreComponents.end());
+        composition->ForEachComponent<ComponentType>(aFunction);
       }
 
       auto component = GetComponent<ComponentType>();
 
       if (component != nullptr)
       {
-        components.emplace_back(component);
+        aFunction(component);
       }
-
-      return components;
     }
 
     YTE_Shared Component* GetDerivedComponent(Type* aType);
@@ -199,7 +227,9 @@ namespace YTE
                     && !std::is_same<Component, tComponentType>(),
                     "Type must be derived from YTE::Component");
 
-      return static_cast<tComponentType*>(GetDerivedComponent(TypeId<tComponentType>()));
+      auto component = mComponentSlots.GetDerived(ComponentTypeIndex::Get<tComponentType>());
+
+      return static_cast<tComponentType*>(component);
     }
 
     YTE_Shared Component* GetComponent(Type *aType);
@@ -257,23 +287,49 @@ namespace YTE
     }
 
   protected:
+    friend class Blueprint;
+    friend class LevelLoader;
+
     YTE_Shared void Create();
 
     YTE_Shared StringComponentFactory* GetFactoryFromEngine(Type* aType);
 
     YTE_Shared void ComponentClear();
+
+    // Finds mDependencyOrder once all of the components have been added.
+    YTE_Shared void OrderComponents();
+
+    // Adds a child composition named aName and deserializes aValue into it.
+    YTE_Shared Composition* DeserializeChild(String const &aName, RSValue *aValue);
+
+    // Adds an empty child composition named aName, for deserializing into.
+    YTE_Shared Composition* EmplaceChild(String const &aName);
+
     YTE_Shared std::string CheckDependencies(std::set<BoundType*> aTypesAvailible, 
                                              BoundType* aTypeToCheck);
 
     YTE_Shared void RemoveCompositionInternal(CompositionMap::iterator& aComposition);
     YTE_Shared void RemoveComponentInternal(ComponentMap::iterator& aComponent);
+    YTE_Shared Component* EmplaceComponent(Type *aType, UniquePointer<Component, ComponentDeleter> aComponent);
+
+    // Keep the lookups that mirror mComponents up to date. Called just after a
+    // component is added and just before one is removed.
+    YTE_Shared void IndexComponent(Type *aType, Component *aComponent);
+    YTE_Shared void UnindexComponent(Type *aType, Component *aComponent);
     YTE_Shared Composition* AddCompositionInternal(String aArchetype, String aObjectName);
+    YTE_Shared std::vector<Composition*> AddCompositionsInternal(String &aArchetype,
+                                                                 String &aObjectName,
+                                                                 size_t aCount,
+                                                                 glm::vec3 const *aPositions);
     YTE_Shared Composition* AddCompositionInternal(std::unique_ptr<Composition> mComposition, 
                                                    RSValue* aSerialization, 
                                                    String aObjectName);
     YTE_Shared bool ParentBeingDeleted();
 
     CompositionMap mCompositions;
+
+    // Before mComponents, so it outlives the components.
+    ComponentSlots mComponentSlots;
     ComponentMap mComponents;
     std::vector<Type*> mDependencyOrder;
 
@@ -15,8 +15,10 @@ All content (c) 2016 DigiPen  (USA) Corporation, all rights reserved.
 #include "YTE/Utilities/Utilities.hpp"
 
 #include "YTE/Core/AssetLoader.hpp"
+#include "YTE/Core/BinaryDocument.hpp"
 #include "YTE/Core/ComponentSystem.hpp"
 #include "YTE/Core/Engine.hpp"
+#include "YTE/Core/LevelLoader.hpp"
 #include "YTE/Core/Threading/JobHandle.hpp"
 #include "YTE/Core/Threading/JobSystem.hpp"
 #include "YTE/Core/ScriptBind.hpp"
@@ -29,6 +31,18 @@ namespace YTE
 {
   namespace fs = std::experimental::filesystem;
 
+  // Reads the binary form of the file at aPath while it's up to date, and
+  // the JSON otherwise.
+  static bool ReadDocument(std::string const &aPath, RSDocument &aDocument)
+  {
+    if (HasCurrentBinary(aPath) && ReadBinaryFile(GetBinaryPath(aPath), aDocument))
+    {
+      return true;
+    }
+
+    return ParseJsonFile(aPath, aDocument);
+  }
+
   YTEDefineEvent(LogicUpdate);
   YTEDefineEvent(PhysicsUpdate);
   YTEDefineEvent(PreLogicUpdate);
@@ -72,6 +86,7 @@ namespace YTE
 
   Engine::Engine(std::vector<const char *> aConfigFilePath, bool aEditorMode)
     : Composition{ this, cEngineName, nullptr }
+    , mFrameScheduler{ this }
     , mFrame{ 0 }
     , mCompositionsByGUID{}
     , mComponentsByGUID{}
@@ -113,10 +128,12 @@ namespace YTE
     mBegin = std::chrono::high_resolution_clock::now();
     mLastFrame = mBegin;
 
-    mComponents.Emplace(TypeId<JobSystem>(), std::make_unique<JobSystem>(this));
-    mComponents.Emplace(TypeId<ComponentSystem>(), std::make_unique<ComponentSystem>(this));
-    mComponents.Emplace(TypeId<WWiseSystem>(), std::make_unique<WWiseSystem>(this));
-    mComponents.Emplace(TypeId<GraphicsSystem>(), std::make_unique<GraphicsSystem>(this));
+    EmplaceComponent(TypeId<JobSystem>(), std::make_unique<JobSystem>(this));
+    EmplaceComponent(TypeId<ComponentSystem>(), std::make_unique<ComponentSystem>(this));
+    EmplaceComponent(TypeId<WWiseSystem>(), std::make_unique<WWiseSystem>(this));
+    EmplaceComponent(TypeId<GraphicsSystem>(), std::make_unique<GraphicsSystem>(this));
+
+    RegisterEvent<&Engine::ClearBlueprints>(Events::BoundTypeChanged, this);
 
     fs::path archetypesPath = Path::GetGamePath().String();
     archetypesPath = archetypesPath.parent_path();
@@ -171,6 +188,16 @@ namespace YTE
                 false == (*aValue)["Spaces"].IsObject(), 
                 "We're trying to serialize something without Spaces.");
 
+    if (aValue->HasMember("JobSystem"))
+    {
+      GetComponent<JobSystem>()->Deserialize(&(*aValue)["JobSystem"]);
+    }
+
+    if (aValue->HasMember("FrameScheduler"))
+    {
+      mFrameScheduler.Deserialize(&(*aValue)["FrameScheduler"]);
+    }
+
     auto &windows = (*aValue)["Windows"];
 
     for (auto windowsIt = windows.MemberBegin(); windowsIt  < windows.MemberEnd(); ++windowsIt)
@@ -280,18 +307,23 @@ namespace YTE
     LogicUpdate updateEvent;
     updateEvent.Dt = mDt;
 
-    SendEvent(Events::DeletionUpdate, &updateEvent);
+    mFrameScheduler.RunPhase(FramePhase::Deletion, Events::DeletionUpdate, &updateEvent);
+
+    mFrameScheduler.RunPhase(FramePhase::Animation, Events::AnimationUpdate, &updateEvent);
 
-    SendEvent(Events::AnimationUpdate, &updateEvent);
-    SendEvent(Events::GraphicsDataUpdate, &updateEvent);
+    // Sync points for deferred events (transform changes, mostly), so
+    // graphics sees everything animation and then logic did.
+    EventHandler::DeliverDeferredEvents();
+
+    mFrameScheduler.RunPhase(FramePhase::GraphicsData, Events::GraphicsDataUpdate, &updateEvent);
 
     GetComponent<WWiseSystem>()->Update(mDt);
   
     mGamepadSystem.Update(mDt);
 
-    SendEvent(Events::PreLogicUpdate, &updateEvent);
-    SendEvent(Events::LogicUpdate, &updateEvent);
-    SendEvent(Events::SpaceUpdate, &updateEvent);
+    mFrameScheduler.RunPhase(FramePhase::PreLogic, Events::PreLogicUpdate, &updateEvent);
+    mFrameScheduler.RunPhase(FramePhase::Logic, Events::LogicUpdate, &updateEvent);
+    mFrameScheduler.RunPhase(FramePhase::Space, Events::SpaceUpdate, &updateEvent);
 
     // If we're told to shut down then our windows might be invalidated
     // so we shouldn't try to run the Graphics updates.
@@ -300,9 +332,11 @@ namespace YTE
       return;
     }
 
-    SendEvent(Events::PreFrameUpdate, &updateEvent);
-    SendEvent(Events::FrameUpdate, &updateEvent);
-    SendEvent(Events::PresentFrame, &updateEvent);
+    EventHandler::DeliverDeferredEvents();
+
+    mFrameScheduler.RunPhase(FramePhase::PreFrame, Events::PreFrameUpdate, &updateEvent);
+    mFrameScheduler.RunPhase(FramePhase::Frame, Events::FrameUpdate, &updateEvent);
+    mFrameScheduler.RunPhase(FramePhase::Present, Events::PresentFrame, &updateEvent);
 
     // We may also have been told to shut down here.
     if (false == mShouldRun)
@@ -310,6 +344,7 @@ namespace YTE
       return;
     }
 
+    mFrameScheduler.EndFrame();
     ++mFrame;
   }
 
@@ -347,6 +382,10 @@ namespace YTE
 
     mCompositions.Clear();
 
+    // Before our own components go, the ComponentSystem among them owns the
+    // pools these were created in.
+    ComponentClear();
+
     mPlugins.clear();
 
     if constexpr (YTE_CAN_PROFILE)
@@ -420,21 +459,19 @@ namespace YTE
     }
 
     auto path = Path::GetArchetypePath(Path::GetGamePath(), aArchetype.c_str());
-    
-    std::string fileText;
-    auto success = ReadFileToString(path, fileText);
 
     auto document = std::make_unique<RSDocument>();
     auto toReturn = document.get();
 
+    auto success = ReadDocument(path, *document);
+
     if (false == success)
     {
       path = Path::GetArchetypePath(Path::GetEnginePath(), aArchetype.c_str());
-      fileText.clear();
-      success = ReadFileToString(path, fileText);
+      success = ReadDocument(path, *document);
     }
 
-    if (success && document->Parse(fileText.c_str()).HasParseError())
+    if (success && document->HasParseError())
     {
       std::cout << "Error in Archetype: " << aArchetype << std::endl;
     }
@@ -444,6 +481,41 @@ namespace YTE
     return toReturn;
   }
 
+  Blueprint* Engine::GetBlueprint(String &aArchetype)
+  {
+    YTEProfileFunction();
+
+    if (mEditorMode)
+    {
+      return nullptr;
+    }
+
+    if (auto iter = mBlueprints.find(aArchetype); iter != mBlueprints.end())
+    {
+      return iter->second.get();
+    }
+
+    auto blueprint = std::make_unique<Blueprint>(this, GetArchetype(aArchetype));
+
+    // Cached either way, the document won't change outside of the editor.
+    if (false == blueprint->IsValid())
+    {
+      blueprint.reset();
+    }
+
+    auto toReturn = blueprint.get();
+    mBlueprints.emplace(aArchetype, std::move(blueprint));
+
+    return toReturn;
+  }
+
+  void Engine::ClearBlueprints(BoundTypeChanged *aEvent)
+  {
+    UnusedArguments(aEvent);
+
+    mBlueprints.clear();
+  }
+
   std::unordered_map<String, UniquePointer<RSDocument>>* Engine::GetArchetypes()
   {
     return &mArchetypes;
@@ -464,23 +536,20 @@ namespace YTE
 
     auto path = Path::GetLevelPath(Path::GetGamePath(), aLevel.c_str());
 
-    std::string fileText;
-    auto success = ReadFileToString(path, fileText);
-
     auto document = std::make_unique<RSDocument>();
     auto toReturn = document.get();
 
+    auto success = ReadDocument(path, *document);
+
     if (false == success)
     {
       path = Path::GetLevelPath(Path::GetEnginePath(), aLevel.c_str());
-
-      fileText.clear();
-      success = ReadFileToString(path, fileText);
+      success = ReadDocument(path, *document);
     }
 
     if (success)
     {
-      auto error = document->Parse(fileText.c_str()).GetParseError();
+      auto error = document->GetParseError();
 
       if (error)
       {
@@ -515,7 +584,7 @@ namespace YTE
     // GUID has NOT already been used for a composition
     if (!collision)
     {
-      mCompositionsByGUID.emplace(std::make_pair(aComposition->GetGUID().ToString(), aComposition));
+      mCompositionsByGUID.emplace(guid, aComposition);
     }
 
     return collision;
@@ -525,7 +594,7 @@ namespace YTE
   {
     YTEProfileFunction();
 
-    auto it = mCompositionsByGUID.find(aGUID.ToString());
+    auto it = mCompositionsByGUID.find(aGUID);
 
     if (it == mCompositionsByGUID.end())
     {
@@ -539,8 +608,7 @@ namespace YTE
   {
     YTEProfileFunction();
 
-    std::string guid = aGUID.ToString();
-    auto it = mCompositionsByGUID.find(guid);
+    auto it = mCompositionsByGUID.find(aGUID);
 
     if (it == mCompositionsByGUID.end())
     {
@@ -559,14 +627,14 @@ namespace YTE
       return false;
     }
 
-    auto it = mCompositionsByGUID.find(aGUID.ToString());
+    auto it = mCompositionsByGUID.find(aGUID);
 
     if (it == mCompositionsByGUID.end())
     {
       return false;
     }
 
-    mCompositionsByGUID.erase(aGUID.ToString());
+    mCompositionsByGUID.erase(it);
     return true;
   }
 
@@ -581,7 +649,7 @@ namespace YTE
     // GUID has NOT already been used for a composition
     if (!collision)
     {
-      mComponentsByGUID.emplace(std::make_pair(aComponent->GetGUID().ToString(), aComponent));
+      mComponentsByGUID.emplace(guid, aComponent);
     }
 
     return collision;
@@ -591,7 +659,7 @@ namespace YTE
   {
     YTEProfileFunction();
 
-    auto it = mComponentsByGUID.find(aGUID.ToString());
+    auto it = mComponentsByGUID.find(aGUID);
 
     if (it == mComponentsByGUID.end())
     {
@@ -605,8 +673,7 @@ namespace YTE
   {
     YTEProfileFunction();
 
-    std::string guid = aGUID.ToString();
-    auto it = mComponentsByGUID.find(guid);
+    auto it = mComponentsByGUID.find(aGUID);
 
     if (it == mComponentsByGUID.end())
     {
@@ -625,14 +692,14 @@ namespace YTE
       return false;
     }
 
-    auto it = mComponentsByGUID.find(aGUID.ToString());
+    auto it = mComponentsByGUID.find(aGUID);
 
     if (it == mComponentsByGUID.end())
     {
       return false;
     }
 
-    mComponentsByGUID.erase(aGUID.ToString());
+    mComponentsByGUID.erase(it);
     return true;
   }
 
@@ -18,8 +18,10 @@
 #include <chrono>
 
 
+#include "YTE/Core/Blueprint.hpp"
 #include "YTE/Core/Composition.hpp"
 #include "YTE/Core/ForwardDeclarations.hpp"
+#include "YTE/Core/FrameScheduler.hpp"
 #include "YTE/Core/Plugin.hpp"
 #include "YTE/Core/Space.hpp"
 
@@ -140,7 +142,12 @@ namespace YTE
 
 
     inline GamepadSystem *GetGamepadSystem() { return &mGamepadSystem; }
+    inline FrameScheduler *GetFrameScheduler() { return &mFrameScheduler; }
     YTE_Shared RSDocument* GetArchetype(String &aArchetype);
+
+    // Null in the editor, where archetypes are reread every time as they may
+    // have been edited, or if the archetype isn't a composition.
+    YTE_Shared Blueprint* GetBlueprint(String &aArchetype);
     YTE_Shared std::unordered_map<String, UniquePointer<RSDocument>>* GetArchetypes(void);
     YTE_Shared RSDocument* GetLevel(String &aLevel);
     YTE_Shared std::unordered_map<String, UniquePointer<RSDocument>>* GetLevels(void);
@@ -174,19 +181,25 @@ namespace YTE
     OrderedMultiMap<Composition*, ComponentMap::iterator> mComponentsToRemove;
 
   private:
+    // Blueprints hold on to types, factories and setters, which a plugin
+    // reload replaces, so they're compiled again on next use.
+    void ClearBlueprints(BoundTypeChanged *aEvent);
+
     GamepadSystem mGamepadSystem;
+    FrameScheduler mFrameScheduler;
 
     std::unordered_map<std::string, std::unique_ptr<Window>> mWindows;
 
     std::unordered_map<String, UniquePointer<RSDocument>> mArchetypes;
+    std::unordered_map<String, UniquePointer<Blueprint>> mBlueprints;
     std::unordered_map<String, UniquePointer<RSDocument>> mLevels;
 
     std::chrono::time_point<std::chrono::high_resolution_clock> mBegin;
     std::chrono::time_point<std::chrono::high_resolution_clock> mLastFrame;
 
-    // all compositions and components mapped to GUIDs (represented as strings)
-    std::unordered_map<std::string, Composition*> mCompositionsByGUID;
-    std::unordered_map<std::string, Component*> mComponentsByGUID;
+    // all compositions and components mapped to their GUIDs
+    std::unordered_map<GlobalUniqueIdentifier, Composition*, GlobalUniqueIdentifierHash> mCompositionsByGUID;
+    std::unordered_map<GlobalUniqueIdentifier, Component*, GlobalUniqueIdentifierHash> mComponentsByGUID;
 
 
     std::unordered_map<std::string, std::unique_ptr<PluginWrapper>> mPlugins;
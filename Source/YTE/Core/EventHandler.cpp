@@ -1,7 +1,77 @@
-﻿#include "YTE/Core/EventHandler.hpp"
+﻿#include <array>
+#include <deque>
+#include <mutex>
+
+#include "YTE/Core/EventHandler.hpp"
+#include "YTE/Core/FrameScheduler.hpp"
 
 namespace YTE 
 {
+  // Events are defined as globals, so the table has to be built on first use
+  // rather than being a global itself.
+  struct EventNames
+  {
+    static EventNames& Get()
+    {
+      static EventNames names;
+      return names;
+    }
+
+    std::mutex mLock;
+    std::unordered_map<std::string, u32> mIds;
+
+    // A deque so GetName can hand out references that outlive the lock.
+    std::deque<std::string> mNames;
+  };
+
+  EventId::EventId(const std::string &aName)
+  {
+    auto &names = EventNames::Get();
+    std::lock_guard<std::mutex> lock(names.mLock);
+
+    auto it = names.mIds.find(aName);
+
+    if (it != names.mIds.end())
+    {
+      mId = it->second;
+      return;
+    }
+
+    mId = static_cast<u32>(names.mNames.size());
+    names.mNames.emplace_back(aName);
+    names.mIds.emplace(aName, mId);
+  }
+
+  EventId EventId::Find(const std::string &aName)
+  {
+    auto &names = EventNames::Get();
+    std::lock_guard<std::mutex> lock(names.mLock);
+
+    EventId id;
+    auto it = names.mIds.find(aName);
+
+    if (it != names.mIds.end())
+    {
+      id.mId = it->second;
+    }
+
+    return id;
+  }
+
+  const std::string& EventId::GetName() const
+  {
+    static const std::string invalid;
+
+    if (false == IsValid())
+    {
+      return invalid;
+    }
+
+    auto &names = EventNames::Get();
+    std::lock_guard<std::mutex> lock(names.mLock);
+    return names.mNames[mId];
+  }
+
   YTEDefineType(Event)
   {
     RegisterType<Event>();
@@ -15,11 +85,44 @@ namespace YTE
   }
 
 
-  void EventHandler::SendEvent(const std::string &aName, Event *aEvent)
+  bool EventHandler::Connection::IsConnected() const
+  {
+    return mDelegate && mGeneration == SlabAllocator<EventDelegate>::GetGeneration(mDelegate);
+  }
+
+  void EventHandler::Connection::Disconnect()
+  {
+    if (IsConnected())
+    {
+      mDelegate->mOwner->RemoveHook(mDelegate->mHookIndex);
+    }
+
+    mDelegate = nullptr;
+  }
+
+  void EventHandler::RemoveHook(size_t aIndex)
+  {
+    if ((aIndex + 1) != mHooks.size())
+    {
+      std::swap(mHooks[aIndex], mHooks.back());
+      mHooks[aIndex]->mHookIndex = aIndex;
+    }
+
+    mHooks.pop_back();
+  }
+
+  void EventHandler::SendEvent(EventId aName, Event *aEvent)
   {
-    YTEProfileName(aName);
+    auto listIt = mEventLists.find(aName);
+
+    if (listIt == mEventLists.end())
+    {
+      return;
+    }
 
-    auto &&list = mEventLists[aName];
+    YTEProfileName(aName.GetName());
+
+    auto &&list = listIt->second;
 
     // If this event is already currently being sent on this object, we don't resend it.
     if (list.mIterating)
@@ -29,8 +132,20 @@ namespace YTE
 
     list.mIterating = true;
 
-    auto it = list.mList.begin();
-    auto end = list.mList.end();
+    InvokeList(list.mList, aEvent);
+
+    if (false == list.mTicks.IsEmpty())
+    {
+      list.mTicks.Run(aEvent);
+    }
+
+    list.mIterating = false;
+  }
+
+  void EventHandler::InvokeList(IntrusiveList<EventDelegate> &aList, Event *aEvent)
+  {
+    auto it = aList.begin();
+    auto end = aList.end();
 
     while (it != end)
     {
@@ -57,9 +172,100 @@ namespace YTE
 
       ++it;
     }
+  }
 
-    list.mIterating = false;
+  EventHandler::~EventHandler()
+  {
+    if (0 != mPostsPending.load(std::memory_order_acquire))
+    {
+      for (size_t i = 0; i < static_cast<size_t>(FramePhase::Count); ++i)
+      {
+        GetPostQueue(static_cast<FramePhase>(i)).Cancel(this);
+      }
+    }
+
+    if (0 == mDeferredQueued)
+    {
+      return;
+    }
+
+    // Only mark the entries, DeliverDeferredEvents may be partway through
+    // the queue.
+    for (auto &list : mEventLists)
+    {
+      if (cNotQueued != list.second.mQueuedAt)
+      {
+        cDeferredEvents[list.second.mQueuedAt].mHandler = nullptr;
+      }
+    }
+  }
+
+  PostQueue& EventHandler::GetPostQueue(FramePhase aPhase)
+  {
+    // Built on first use, jobs may post before the Engine has finished
+    // starting up.
+    static std::array<PostQueue, static_cast<size_t>(FramePhase::Count)> queues;
+    return queues[static_cast<size_t>(aPhase)];
+  }
+
+  void EventHandler::DeliverPostedEvents(FramePhase aPhase)
+  {
+    GetPostQueue(aPhase).Deliver();
+  }
+
+  void EventHandler::QueueDeferred(EventList &aList)
+  {
+    aList.mQueuedAt = cDeferredEvents.size();
+    cDeferredEvents.push_back(DeferredEvent{ this, &aList });
+    ++mDeferredQueued;
+  }
+
+  void EventHandler::DeliverDeferredEvents()
+  {
+    YTEProfileFunction();
+
+    // Only what's queued now, anything listeners queue waits for next time.
+    size_t count = cDeferredEvents.size();
+
+    for (size_t i = 0; i < count; ++i)
+    {
+      auto deferred = cDeferredEvents[i];
+
+      // The handler was destroyed since it was queued.
+      if (nullptr == deferred.mHandler)
+      {
+        continue;
+      }
+
+      // Dequeued first, so a listener sending it again queues it for the
+      // next sync point (the rest of this delivery sees the newer copy).
+      deferred.mList->mQueuedAt = cNotQueued;
+      --deferred.mHandler->mDeferredQueued;
+
+      InvokeList(deferred.mList->mDeferred, deferred.mList->mDeferredEvent.get());
+    }
+
+    cDeferredEvents.erase(cDeferredEvents.begin(), cDeferredEvents.begin() + count);
+
+    for (size_t i = 0; i < cDeferredEvents.size(); ++i)
+    {
+      if (cDeferredEvents[i].mHandler)
+      {
+        cDeferredEvents[i].mList->mQueuedAt = i;
+      }
+    }
+  }
+
+  void EventHandler::SendEvent(const std::string &aName, Event *aEvent)
+  {
+    EventId id = EventId::Find(aName);
+
+    if (id.IsValid())
+    {
+      SendEvent(id, aEvent);
+    }
   }
 
-  std::map<std::string, BlockAllocator<EventHandler::EventDelegate>> EventHandler::cDelegateAllocators;
+  SlabAllocator<EventHandler::EventDelegate> EventHandler::cDelegates;
+  std::vector<EventHandler::DeferredEvent> EventHandler::cDeferredEvents;
 }
\ No newline at end of file
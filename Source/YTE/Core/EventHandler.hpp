@@ -10,31 +10,104 @@ All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
 #ifndef YTE_Core_EventHandler_hpp
 #define YTE_Core_EventHandler_hpp
 
+#include <atomic>
 #include <functional>
 #include <iostream>
 #include <memory>
 #include <set>
 #include <map>
+#include <unordered_map>
 #include <vector>
 
 #include "YTE/Core/Object.hpp"
+#include "YTE/Core/PostQueue.hpp"
+#include "YTE/Core/TickList.hpp"
 
 #include "YTE/StandardLibrary/Delegate.hpp"
 #include "YTE/StandardLibrary/IntrusiveList.hpp"
-#include "YTE/StandardLibrary/BlockAllocator.hpp"
+#include "YTE/StandardLibrary/SlabAllocator.hpp"
 
 namespace YTE
 {
-  #define YTEDeclareEvent(aName)                 \
-  namespace Events                               \
-  {                                              \
-      YTE_Shared extern const std::string aName; \
+  // Defined with the FrameScheduler.
+  enum class FramePhase;
+
+  // An event name, interned to a small integer the first time it's seen so
+  // registering and sending never hash the string. Ids are never reused, so
+  // they're safe to keep for the life of the program.
+  class EventId
+  {
+  public:
+    EventId()
+      : mId(cInvalid)
+    {
+    }
+
+    // Interns aName if this is the first time we've seen it.
+    YTE_Shared explicit EventId(const std::string &aName);
+
+    // Doesn't intern, a name that's never been seen has no listeners, so
+    // this gives back an invalid id.
+    YTE_Shared static EventId Find(const std::string &aName);
+
+    YTE_Shared const std::string& GetName() const;
+
+    u32 GetIndex() const
+    {
+      return mId;
+    }
+
+    bool IsValid() const
+    {
+      return cInvalid != mId;
+    }
+
+    bool operator==(EventId aRight) const
+    {
+      return mId == aRight.mId;
+    }
+
+    bool operator!=(EventId aRight) const
+    {
+      return mId != aRight.mId;
+    }
+
+    bool operator<(EventId aRight) const
+    {
+      return mId < aRight.mId;
+    }
+
+  private:
+    static constexpr u32 cInvalid = ~u32(0);
+
+    u32 mId;
+  };
+}
+
+namespace std
+{
+  template<>
+  struct hash<YTE::EventId>
+  {
+    size_t operator()(YTE::EventId aId) const
+    {
+      return aId.GetIndex();
+    }
+  };
+}
+
+namespace YTE
+{
+  #define YTEDeclareEvent(aName)             \
+  namespace Events                           \
+  {                                          \
+      YTE_Shared extern const EventId aName; \
   }
 
-  #define YTEDefineEvent(aName)         \
-  namespace Events                      \
-  {                                     \
-      const std::string aName = #aName; \
+  #define YTEDefineEvent(aName)                   \
+  namespace Events                                \
+  {                                               \
+      const EventId aName{ std::string(#aName) }; \
   }
 
   class Event : public Object
@@ -43,6 +116,16 @@ namespace YTE
     YTEDeclareType(Event);
   };
 
+  // Events sent with SendCoalescedEvent that are sent again before they're
+  // delivered are merged with aQueued.Coalesce(aNewer) if the event type has
+  // one, otherwise the newer event replaces the queued one.
+  template <typename tEventType, typename = void>
+  struct HasCoalesce : std::false_type {};
+
+  template <typename tEventType>
+  struct HasCoalesce<tEventType, std::void_t<decltype(std::declval<tEventType&>().Coalesce(std::declval<const tEventType&>()))>>
+    : std::true_type {};
+
   class EventHandler : public Object
   {
   public:
@@ -65,10 +148,12 @@ namespace YTE
     {
     public:
       template<typename tObjectType = EventHandler>
-      EventDelegate(tObjectType * aObj, Invoker aInvoker, const std::string &aName)
+      EventDelegate(tObjectType * aObj, Invoker aInvoker, EventId aName)
         : DelegateType(aObj, aInvoker)
         , mName(aName)
         , mHook(this)
+        , mOwner(nullptr)
+        , mHookIndex(0)
       {
 
       }
@@ -77,6 +162,8 @@ namespace YTE
         : DelegateType(std::move(*this))
         , mName(aEventDelegate.mName)
         , mHook(std::move(aEventDelegate.mHook), this)
+        , mOwner(aEventDelegate.mOwner)
+        , mHookIndex(aEventDelegate.mHookIndex)
       {
       }
 
@@ -92,15 +179,49 @@ namespace YTE
         return DelegateType(aObj, Caller<tFunctionType, aFunction, tObjectType, tEventType>);
       }
 
-      const std::string &mName;
+      EventId mName;
       IntrusiveList<EventDelegate>::Hook mHook;
+
+      // The object that registered, which owns this delegate, and where it
+      // is in that object's mHooks.
+      EventHandler *mOwner;
+      size_t mHookIndex;
     };
 
-    using Deleter = BlockAllocator<EventDelegate>::Deleter;
+    using Deleter = SlabAllocator<EventDelegate>::Deleter;
     using UniqueEvent = std::unique_ptr<EventDelegate, Deleter>;
 
+    // One registration, as returned by RegisterEvent. Disconnecting it is
+    // constant time, and it's safe to hold on to after either object is
+    // destroyed (or it's been deregistered some other way), it's just no
+    // longer connected.
+    class Connection
+    {
+    public:
+      Connection()
+        : mDelegate(nullptr)
+        , mGeneration(0)
+      {
+      }
+
+      YTE_Shared bool IsConnected() const;
+      YTE_Shared void Disconnect();
+
+    private:
+      friend class EventHandler;
+
+      Connection(EventDelegate *aDelegate)
+        : mDelegate(aDelegate)
+        , mGeneration(SlabAllocator<EventDelegate>::GetGeneration(aDelegate))
+      {
+      }
+
+      EventDelegate *mDelegate;
+      u32 mGeneration;
+    };
+
     template <auto tFunction, typename tObjectType>
-    void RegisterEvent(const std::string &aName, tObjectType *aObject)
+    Connection RegisterEvent(EventId aName, tObjectType *aObject)
     {
       using tFunctionType = decltype(tFunction);
 
@@ -113,10 +234,40 @@ namespace YTE
 
       auto delegate = aObject->template MakeEventDelegate<tFunctionType, tFunction, tObjectType>(aName, aObject);
       mEventLists[delegate->mName].mList.InsertFront(delegate->mHook);
+      return Connection(delegate);
+    }
+
+    // For names only known at runtime (scripts, the editor).
+    template <auto tFunction, typename tObjectType>
+    Connection RegisterEvent(const std::string &aName, tObjectType *aObject)
+    {
+      return RegisterEvent<tFunction>(EventId(aName), aObject);
+    }
+
+    // Like RegisterEvent, but aObject only hears about aName from
+    // SendCoalescedEvent, at most once per sync point (see
+    // DeliverDeferredEvents) no matter how many times it was sent since.
+    // For listeners that only care about the latest state, like anything
+    // uploading a transform to the GPU. DeregisterEvent removes these too.
+    template <auto tFunction, typename tObjectType>
+    Connection RegisterDeferredEvent(EventId aName, tObjectType *aObject)
+    {
+      using tFunctionType = decltype(tFunction);
+
+      static_assert(std::is_member_function_pointer_v<tFunctionType>,
+                    "tFunctionType must be a member function pointer from the type of tObjectType.");
+      static_assert(1 == CountFunctionArguments<tFunctionType>::template Size(),
+                    "tFunctionType must have exactly one argument. A pointer to an object of a type derived from YTE::Event.");
+      static_assert(std::is_base_of<EventHandler, tObjectType>::value,
+                    "tObjectType must be derived from YTE::EventHandler");
+
+      auto delegate = aObject->template MakeEventDelegate<tFunctionType, tFunction, tObjectType>(aName, aObject);
+      mEventLists[delegate->mName].mDeferred.InsertFront(delegate->mHook);
+      return Connection(delegate);
     }
 
     template <typename tFunctionType, tFunctionType aFunction, typename tObjectType>
-    EventDelegate* MakeEventDelegate(const std::string &aName, tObjectType *aObject)
+    EventDelegate* MakeEventDelegate(EventId aName, tObjectType *aObject)
     {
       using EventType = typename Binding<tFunctionType>::EventType;
       using ObjectType = typename Binding<tFunctionType>::ObjectType;
@@ -128,24 +279,16 @@ namespace YTE
                     "EventType must be derived from Event");
       Invoker callerFunction = EventDelegate::Caller<tFunctionType, aFunction, tObjectType, EventType>;
 
-      auto it = cDelegateAllocators.find(aName);
-
-      if (it == cDelegateAllocators.end())
-      {
-        cDelegateAllocators.emplace(aName, BlockAllocator<EventDelegate>{});
+      auto ptr = cDelegates.Create(aObject, callerFunction, aName);
+      ptr->mOwner = this;
+      ptr->mHookIndex = mHooks.size();
 
-        it = cDelegateAllocators.find(aName);
-      }
-
-      auto ptr = it->second.allocate();
-
-      new(ptr) EventDelegate(aObject, callerFunction, it->first);
-      mHooks.emplace_back(std::move(UniqueEvent(ptr, it->second.GetDeleter())));
-      return mHooks.back().get();
+      mHooks.emplace_back(UniqueEvent(ptr, cDelegates.GetDeleter()));
+      return ptr;
     }
 
     template <auto tFunction, typename tObjectType>
-    void DeregisterEvent(const std::string &aName, tObjectType *aObject)
+    void DeregisterEvent(EventId aName, tObjectType *aObject)
     {
       using tFunctionType = decltype(tFunction);
 
@@ -159,8 +302,14 @@ namespace YTE
       aObject->template RemoveEventDelegate<tFunctionType, tFunction, tObjectType>(aName, aObject);
     }
 
+    template <auto tFunction, typename tObjectType>
+    void DeregisterEvent(const std::string &aName, tObjectType *aObject)
+    {
+      DeregisterEvent<tFunction>(EventId::Find(aName), aObject);
+    }
+
     template <typename tFunctionType, tFunctionType aFunction, typename tObjectType>
-    void RemoveEventDelegate(const std::string &aName, tObjectType *aObject)
+    void RemoveEventDelegate(EventId aName, tObjectType *aObject)
     {
       using EventType = typename Binding<tFunctionType>::EventType;
 
@@ -178,12 +327,161 @@ namespace YTE
 
       if (it != mHooks.end())
       {
-        mHooks.erase(it);
+        RemoveHook(static_cast<size_t>(it - mHooks.begin()));
+      }
+    }
+
+    // For events sent every frame to many objects of the same few types
+    // (LogicUpdate, FrameUpdate, AnimationUpdate). Rather than a delegate per
+    // object, aObject goes into a contiguous array with every other object
+    // registered with tFunction, and they're ticked in a tight loop.
+    //
+    // Unlike delegates this isn't one registration order for the whole event:
+    // every ordinary delegate runs first, then the ticks, a group per member
+    // function in the order each was first registered, objects within a group
+    // in the order they registered. So a tick never runs before a delegate
+    // on the same event, and only use it where objects of different types
+    // don't depend on ticking in a particular order relative to each other.
+    //
+    // Like RegisterEvent, the registration belongs to aObject and is removed
+    // when it's destroyed, and it's safe to register or deregister while the
+    // event is being sent.
+    template <auto tFunction, typename tObjectType>
+    void RegisterTick(EventId aName, tObjectType *aObject)
+    {
+      using tFunctionType = decltype(tFunction);
+      using EventType = typename Binding<tFunctionType>::EventType;
+      using ObjectType = typename Binding<tFunctionType>::ObjectType;
+
+      static_assert(std::is_member_function_pointer_v<tFunctionType>,
+                    "tFunctionType must be a member function pointer from the type of tObjectType.");
+      static_assert(std::is_same<ObjectType, tObjectType>::value, 
+                    "The member function must be a member of the same type as the instance passed (tObjectType *aObject).");
+      static_assert(std::is_base_of<Event, EventType>::value, 
+                    "EventType must be derived from Event");
+      static_assert(std::is_base_of<EventHandler, tObjectType>::value,
+                    "tObjectType must be derived from YTE::EventHandler");
+
+      EventHandler *owner = aObject;
+      owner->mTicks.emplace_back(std::make_unique<TickRegistration>(&mEventLists[aName].mTicks, 
+                                                                    aObject, 
+                                                                    &RunTicks<tFunction, tObjectType, EventType>));
+    }
+
+    template <auto tFunction, typename tObjectType>
+    void DeregisterTick(EventId aName, tObjectType *aObject)
+    {
+      using EventType = typename Binding<decltype(tFunction)>::EventType;
+
+      auto listIt = mEventLists.find(aName);
+
+      if (listIt == mEventLists.end())
+      {
+        return;
+      }
+
+      TickList *list = &listIt->second.mTicks;
+      TickRegistration::Runner runner = &RunTicks<tFunction, tObjectType, EventType>;
+      EventHandler *owner = aObject;
+
+      auto it = std::find_if(owner->mTicks.begin(),
+                             owner->mTicks.end(),
+                             [list, aObject, runner](const std::unique_ptr<TickRegistration> &aTick)
+      {
+        return aTick->GetList() == list &&
+               aTick->GetObject() == static_cast<void*>(aObject) &&
+               aTick->GetRunner() == runner;
+      });
+
+      if (it != owner->mTicks.end())
+      {
+        owner->mTicks.erase(it);
       }
     }
 
+    // Objects nothing has registered aName on skip it after one lookup.
+    YTE_Shared void SendEvent(EventId aName, Event *aEvent);
     YTE_Shared void SendEvent(const std::string &aName, Event *aEvent);
 
+    // Sends aEvent to aName's ordinary listeners now, and if there are any
+    // deferred listeners, queues a copy for them. Sending again before it's
+    // delivered coalesces into the queued copy (see HasCoalesce), so every
+    // send of aName on this object must use the same tEventType.
+    //
+    // Main thread only, like DeliverDeferredEvents, so the queue and the
+    // queued copies aren't locked. A job with a change to report should
+    // PostEvent it, or leave it for the main thread to apply (as physics does
+    // with Bullet's transforms, see PhysicsSystem::ApplyMotionStates).
+    template <typename tEventType>
+    void SendCoalescedEvent(EventId aName, tEventType *aEvent)
+    {
+      static_assert(std::is_base_of<Event, tEventType>::value, "tEventType must be derived from Event");
+
+      SendEvent(aName, aEvent);
+
+      auto it = mEventLists.find(aName);
+
+      if (it == mEventLists.end() || it->second.mDeferred.Empty())
+      {
+        return;
+      }
+
+      auto &list = it->second;
+
+      if (nullptr == list.mDeferredEvent)
+      {
+        list.mDeferredEvent = std::make_unique<tEventType>(*aEvent);
+      }
+      else if (cNotQueued == list.mQueuedAt)
+      {
+        *static_cast<tEventType*>(list.mDeferredEvent.get()) = *aEvent;
+      }
+      else if constexpr (HasCoalesce<tEventType>::value)
+      {
+        static_cast<tEventType*>(list.mDeferredEvent.get())->Coalesce(*aEvent);
+      }
+      else
+      {
+        *static_cast<tEventType*>(list.mDeferredEvent.get()) = *aEvent;
+      }
+
+      if (cNotQueued == list.mQueuedAt)
+      {
+        QueueDeferred(list);
+      }
+    }
+
+    // Any thread. aEvent is sent from this object on the main thread at the
+    // start of aPhase (see FrameScheduler::RunPhase), so jobs can hand
+    // results to components without locking them. The event is copied into
+    // a preallocated queue, so it must fit in PostQueue::cPayloadSize.
+    //
+    // This object must outlive the call, posts still waiting when it's
+    // destroyed are dropped.
+    template <typename tEventType>
+    void PostEvent(EventId aName, tEventType aEvent, FramePhase aPhase)
+    {
+      static_assert(std::is_base_of<Event, tEventType>::value, "tEventType must be derived from Event");
+
+      mPostsPending.fetch_add(1, std::memory_order_relaxed);
+      GetPostQueue(aPhase).Post<Posted<tEventType>>(this,
+                                                    &DispatchPosted<tEventType>,
+                                                    aName,
+                                                    std::move(aEvent));
+    }
+
+    // Main thread only, the FrameScheduler calls it at the start of each
+    // phase.
+    YTE_Shared static void DeliverPostedEvents(FramePhase aPhase);
+
+    // The sync point: every event queued by SendCoalescedEvent so far is
+    // delivered to its deferred listeners, on every EventHandler. Anything
+    // queued while delivering waits for the next call. Main thread only,
+    // the Engine calls it between frame phases.
+    YTE_Shared static void DeliverDeferredEvents();
+
+    YTE_Shared ~EventHandler();
+
     EventHandler() {}
     EventHandler(const EventHandler& aEventHandler)
     { 
@@ -197,46 +495,92 @@ namespace YTE
     }
 
   protected:
-    struct StdStringRefWrapperEquality
+    static constexpr size_t cNotQueued = ~size_t(0);
+
+    struct EventList
     {
-      bool operator()(const std::reference_wrapper<const std::string>& aLeft,
-                      const std::reference_wrapper<const std::string>& aRight) const
+      EventList()
+        : mIterating(false)
       {
-        return aLeft.get() == aRight.get();
-      }
 
-      bool operator()(const std::reference_wrapper<std::string>& aLeft,
-                      const std::string &aRight) const
-      {
-        return aLeft.get() == aRight;
       }
 
-      bool operator()(const std::string &aLeft,
-                      const std::reference_wrapper<std::string> &aRight) const
+      bool mIterating;
+      IntrusiveList<EventDelegate> mList;
+      TickList mTicks;
+
+      // Listeners from RegisterDeferredEvent, the copy of the event they'll
+      // be sent, and where it's queued in cDeferredEvents, if it is.
+      IntrusiveList<EventDelegate> mDeferred;
+      std::unique_ptr<Event> mDeferredEvent;
+      size_t mQueuedAt = cNotQueued;
+    };
+
+    struct DeferredEvent
+    {
+      EventHandler *mHandler;
+      EventList *mList;
+    };
+
+    template <typename tEventType>
+    struct Posted
+    {
+      Posted(EventId aName, tEventType &&aEvent)
+        : mName(aName)
+        , mEvent(std::move(aEvent))
       {
-        return aLeft == aRight.get();
       }
+
+      EventId mName;
+      tEventType mEvent;
     };
 
-    struct EventList
+    template <typename tEventType>
+    static void DispatchPosted(void *aTarget, void *aPayload)
     {
-      EventList()
-        : mIterating(false)
-      {
+      auto posted = static_cast<Posted<tEventType>*>(aPayload);
 
+      if (auto handler = static_cast<EventHandler*>(aTarget))
+      {
+        // Before sending, the handler might not survive it.
+        handler->mPostsPending.fetch_sub(1, std::memory_order_relaxed);
+        handler->SendEvent(posted->mName, &posted->mEvent);
       }
 
-      bool mIterating;
-      IntrusiveList<EventDelegate> mList;
-    };
+      posted->~Posted();
+    }
+
+    YTE_Shared static PostQueue& GetPostQueue(FramePhase aPhase);
+
+    // Destroys the delegate at aIndex in mHooks, the last one takes its place.
+    YTE_Shared void RemoveHook(size_t aIndex);
+
+    YTE_Shared void QueueDeferred(EventList &aList);
+    static void InvokeList(IntrusiveList<EventDelegate> &aList, Event *aEvent);
+
+    template <auto tFunction, typename tObjectType, typename tEventType>
+    static void RunTicks(void * const *aObjects, size_t aCount, Event *aEvent)
+    {
+      auto event = static_cast<tEventType*>(aEvent);
+
+      for (size_t i = 0; i < aCount; ++i)
+      {
+        // Null where an object deregistered partway through.
+        if (auto object = static_cast<tObjectType*>(aObjects[i]))
+        {
+          (object->*tFunction)(event);
+        }
+      }
+    }
 
     std::vector<UniqueEvent> mHooks;
-    std::unordered_map<std::reference_wrapper<const std::string>, 
-                       EventList,
-                       std::hash<std::string>, 
-                       StdStringRefWrapperEquality> mEventLists;
+    std::vector<std::unique_ptr<TickRegistration>> mTicks;
+    size_t mDeferredQueued = 0;
+    std::atomic<size_t> mPostsPending{ 0 };
+    std::unordered_map<EventId, EventList> mEventLists;
 
-    YTE_Shared static std::map<std::string, BlockAllocator<EventDelegate>> cDelegateAllocators;
+    YTE_Shared static SlabAllocator<EventDelegate> cDelegates;
+    YTE_Shared static std::vector<DeferredEvent> cDeferredEvents;
   };
 }
 
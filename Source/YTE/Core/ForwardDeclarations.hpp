@@ -13,15 +13,19 @@ All content (c) 2016 DigiPen  (USA) Corporation, all rights reserved.
 
 namespace YTE
 {
+  class Blueprint;
   class Engine;
   class Space;
   class Object;
   class Composition;
+  class LevelLoader;
   class Component;
   class LogicUpdate;
   class CompositionRemoved;
   class BoundTypeChanged;
   template <typename T> class ComponentFactory;
+  template <typename T> class ComponentPool;
+  class ComponentPoolBase;
   class ComponentSystem;
   class StringComponentFactory;
   class JobHandle;
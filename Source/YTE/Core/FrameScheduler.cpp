@@ -0,0 +1,332 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#include <algorithm>
+#include <chrono>
+#include <unordered_map>
+
+#include "YTE/Core/Engine.hpp"
+#include "YTE/Core/FrameScheduler.hpp"
+#include "YTE/Core/Threading/JobSystem.hpp"
+
+namespace YTE
+{
+  using Clock = std::chrono::high_resolution_clock;
+
+  static double SecondsSince(Clock::time_point aBegin)
+  {
+    return std::chrono::duration<double>(Clock::now() - aBegin).count();
+  }
+
+  char const* ToString(FramePhase aPhase)
+  {
+    switch (aPhase)
+    {
+      case FramePhase::Deletion: return "Deletion";
+      case FramePhase::Animation: return "Animation";
+      case FramePhase::GraphicsData: return "GraphicsData";
+      case FramePhase::PreLogic: return "PreLogic";
+      case FramePhase::Logic: return "Logic";
+      case FramePhase::Space: return "Space";
+      case FramePhase::PreFrame: return "PreFrame";
+      case FramePhase::Frame: return "Frame";
+      case FramePhase::Present: return "Present";
+      default: return "Unknown";
+    }
+  }
+
+  FrameScheduler::FrameScheduler(Engine *aEngine)
+    : mEngine(aEngine)
+    , mNextId(cInvalidTask + 1)
+    , mReportInterval(0)
+    , mFramesSinceReport(0)
+    , mEnabled(false)
+    , mRunning(false)
+  {
+  }
+
+  void FrameScheduler::Deserialize(RSValue *aValue)
+  {
+    if (false == aValue->IsObject())
+    {
+      return;
+    }
+
+    if (aValue->HasMember("Enabled") && (*aValue)["Enabled"].IsBool())
+    {
+      mEnabled = (*aValue)["Enabled"].GetBool();
+    }
+
+    if (aValue->HasMember("ReportInterval") && (*aValue)["ReportInterval"].IsUint())
+    {
+      mReportInterval = (*aValue)["ReportInterval"].GetUint();
+    }
+  }
+
+  FrameScheduler::TaskId FrameScheduler::AddTask(FramePhase aPhase,
+                                                 std::string aName,
+                                                 TaskFunction aFunction,
+                                                 std::vector<Resource> aReads,
+                                                 std::vector<Resource> aWrites)
+  {
+    DebugObjection(mRunning, "FrameScheduler tasks can't be added while a phase is running.");
+    DebugObjection(FramePhase::Count <= aPhase, "Invalid FramePhase.");
+
+    auto &phase = mPhases[static_cast<size_t>(aPhase)];
+
+    Task task;
+    task.mId = mNextId++;
+    task.mName = std::move(aName);
+    task.mFunction = std::move(aFunction);
+    task.mReads = std::move(aReads);
+    task.mWrites = std::move(aWrites);
+
+    phase.mTasks.emplace_back(std::move(task));
+    phase.mDirty = true;
+
+    return phase.mTasks.back().mId;
+  }
+
+  void FrameScheduler::RemoveTask(TaskId aTask)
+  {
+    DebugObjection(mRunning, "FrameScheduler tasks can't be removed while a phase is running.");
+
+    if (cInvalidTask == aTask)
+    {
+      return;
+    }
+
+    for (auto &phase : mPhases)
+    {
+      auto it = std::find_if(phase.mTasks.begin(),
+                             phase.mTasks.end(),
+                             [aTask](Task const &aOther) { return aOther.mId == aTask; });
+
+      if (it != phase.mTasks.end())
+      {
+        phase.mTasks.erase(it);
+        phase.mDirty = true;
+        return;
+      }
+    }
+  }
+
+  void FrameScheduler::RunPhase(FramePhase aPhase,
+                                EventId aEventName,
+                                LogicUpdate *aEvent)
+  {
+    YTEProfileBlock(ToString(aPhase));
+
+    auto &phase = mPhases[static_cast<size_t>(aPhase)];
+
+    // Before the tasks, so they see what jobs finished since last frame.
+    EventHandler::DeliverPostedEvents(aPhase);
+
+    if (false == phase.mTasks.empty())
+    {
+      auto begin = Clock::now();
+      RunTasks(phase, aEvent);
+      phase.mFrame.mTasks += SecondsSince(begin);
+    }
+
+    auto begin = Clock::now();
+    mEngine->SendEvent(aEventName, aEvent);
+    phase.mFrame.mEvent += SecondsSince(begin);
+  }
+
+  void FrameScheduler::EndFrame()
+  {
+    for (auto &phase : mPhases)
+    {
+      phase.mTotal.mTasks += phase.mFrame.mTasks;
+      phase.mTotal.mWork += phase.mFrame.mWork;
+      phase.mTotal.mCriticalPath += phase.mFrame.mCriticalPath;
+      phase.mTotal.mEvent += phase.mFrame.mEvent;
+      phase.mFrame = PhaseTimings{};
+    }
+
+    ++mFramesSinceReport;
+
+    if (0 != mReportInterval && mReportInterval <= mFramesSinceReport)
+    {
+      Report();
+    }
+  }
+
+  void FrameScheduler::BuildDependencies(Phase &aPhase)
+  {
+    constexpr size_t noWriter = static_cast<size_t>(-1);
+
+    struct ResourceUse
+    {
+      size_t mWriter = noWriter;
+      std::vector<size_t> mReaders;
+    };
+
+    std::unordered_map<Resource, ResourceUse> uses;
+
+    for (size_t i = 0; i < aPhase.mTasks.size(); ++i)
+    {
+      auto &task = aPhase.mTasks[i];
+      auto &dependencies = task.mDependencies;
+      dependencies.clear();
+
+      // Reads wait on the last writer.
+      for (auto resource : task.mReads)
+      {
+        auto &use = uses[resource];
+
+        if (noWriter != use.mWriter)
+        {
+          dependencies.push_back(use.mWriter);
+        }
+
+        use.mReaders.push_back(i);
+      }
+
+      // Writes wait on the last writer and everyone who's read since.
+      for (auto resource : task.mWrites)
+      {
+        auto &use = uses[resource];
+
+        if (noWriter != use.mWriter)
+        {
+          dependencies.push_back(use.mWriter);
+        }
+
+        for (auto reader : use.mReaders)
+        {
+          if (reader != i)
+          {
+            dependencies.push_back(reader);
+          }
+        }
+
+        use.mWriter = i;
+        use.mReaders.clear();
+      }
+
+      std::sort(dependencies.begin(), dependencies.end());
+      dependencies.erase(std::unique(dependencies.begin(), dependencies.end()),
+                         dependencies.end());
+    }
+
+    aPhase.mDirty = false;
+  }
+
+  void FrameScheduler::RunTasks(Phase &aPhase, LogicUpdate *aEvent)
+  {
+    if (aPhase.mDirty)
+    {
+      BuildDependencies(aPhase);
+    }
+
+    mRunning = true;
+
+    auto jobSystem = mEngine->GetComponent<JobSystem>();
+
+    if (mEnabled && jobSystem && 1 < aPhase.mTasks.size())
+    {
+      mHandles.clear();
+
+      for (auto &task : aPhase.mTasks)
+      {
+        mDependencies.clear();
+
+        for (auto dependency : task.mDependencies)
+        {
+          mDependencies.push_back(mHandles[dependency]);
+        }
+
+        Task *toRun = &task;
+        mHandles.emplace_back(jobSystem->QueueJobAfter(mDependencies, [toRun, aEvent](JobHandle&)
+        {
+          RunTask(*toRun, aEvent);
+        }, JobPriority::FrameCritical));
+      }
+
+      auto all = jobSystem->WhenAll(mHandles);
+      jobSystem->WaitThisThread(all);
+
+      mHandles.clear();
+      mDependencies.clear();
+    }
+    else
+    {
+      for (auto &task : aPhase.mTasks)
+      {
+        RunTask(task, aEvent);
+      }
+    }
+
+    mRunning = false;
+
+    // Dependencies always come earlier in the list, so one pass finds the
+    // longest chain ending at each task.
+    std::vector<double> finish(aPhase.mTasks.size(), 0.0);
+    double criticalPath = 0.0;
+
+    for (size_t i = 0; i < aPhase.mTasks.size(); ++i)
+    {
+      auto &task = aPhase.mTasks[i];
+      double start = 0.0;
+
+      for (auto dependency : task.mDependencies)
+      {
+        start = std::max(start, finish[dependency]);
+      }
+
+      finish[i] = start + task.mDuration;
+      criticalPath = std::max(criticalPath, finish[i]);
+      aPhase.mFrame.mWork += task.mDuration;
+    }
+
+    aPhase.mFrame.mCriticalPath += criticalPath;
+  }
+
+  void FrameScheduler::RunTask(Task &aTask, LogicUpdate *aEvent)
+  {
+    YTEProfileBlock(aTask.mName.c_str());
+
+    auto begin = Clock::now();
+    aTask.mFunction(aEvent);
+    aTask.mDuration = SecondsSince(begin);
+  }
+
+  void FrameScheduler::Report()
+  {
+    double frames = static_cast<double>(mFramesSinceReport);
+    double frameCriticalPath = 0.0;
+
+    std::string report = fmt::format("FrameScheduler: averages over {} frames ({}), in ms\n",
+                                     mFramesSinceReport,
+                                     mEnabled ? "parallel" : "serial");
+
+    for (size_t i = 0; i < mPhases.size(); ++i)
+    {
+      auto &phase = mPhases[i];
+      auto &total = phase.mTotal;
+
+      report += fmt::format("  {:<12} tasks: {:3} wall: {:8.3f} work: {:8.3f} critical path: {:8.3f} event: {:8.3f}\n",
+                            ToString(static_cast<FramePhase>(i)),
+                            phase.mTasks.size(),
+                            1000.0 * total.mTasks / frames,
+                            1000.0 * total.mWork / frames,
+                            1000.0 * total.mCriticalPath / frames,
+                            1000.0 * total.mEvent / frames);
+
+      frameCriticalPath += total.mCriticalPath + total.mEvent;
+      total = PhaseTimings{};
+    }
+
+    report += fmt::format("  Critical path through all phases: {:8.3f}\n",
+                          1000.0 * frameCriticalPath / frames);
+
+    mFramesSinceReport = 0;
+
+    mEngine->Log(LogType::Information, report);
+  }
+}
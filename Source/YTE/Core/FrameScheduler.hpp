@@ -0,0 +1,158 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#pragma once
+
+#ifndef YTE_Core_FrameScheduler_hpp
+#define YTE_Core_FrameScheduler_hpp
+
+#include <array>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "YTE/Core/ForwardDeclarations.hpp"
+#include "YTE/Core/Utilities.hpp"
+#include "YTE/Core/Threading/JobHandle.hpp"
+
+namespace YTE
+{
+  // The phases of Engine::Update, in the order they run.
+  enum class FramePhase
+  {
+    Deletion,
+    Animation,
+    GraphicsData,
+    PreLogic,
+    Logic,
+    Space,
+    PreFrame,
+    Frame,
+    Present,
+    Count
+  };
+
+  YTE_Shared char const* ToString(FramePhase aPhase);
+
+  // Runs work that has declared what it reads and writes ahead of each phase's
+  // event. Tasks in a phase only wait on earlier tasks (in the order they were
+  // added) that write something they read, or that touch something they
+  // write, so independent tasks can run on the JobSystem at the same time.
+  // The phase's event is still sent on the main thread once every task is
+  // done, so listeners don't need to change.
+  //
+  // Resources are just addresses, typically the component doing the work and
+  // any shared data it writes (like a Mesh's Skeleton), so two tasks conflict
+  // only if they name the same object.
+  //
+  // Tasks run in parallel only when the Engine config opts in:
+  //   "FrameScheduler": { "Enabled": true, "ReportInterval": 300 }
+  // Otherwise they're run serially in order, which keeps the split between
+  // task and event identical either way. ReportInterval is in frames, 0
+  // disables the timing report.
+  class FrameScheduler
+  {
+  public:
+    using TaskId = u64;
+    using Resource = void const*;
+    using TaskFunction = std::function<void(LogicUpdate*)>;
+
+    static constexpr TaskId cInvalidTask = 0;
+
+    YTE_Shared FrameScheduler(Engine *aEngine);
+
+    YTE_Shared void Deserialize(RSValue *aValue);
+
+    // Must not be called while a phase's tasks are running.
+    YTE_Shared TaskId AddTask(FramePhase aPhase,
+                              std::string aName,
+                              TaskFunction aFunction,
+                              std::vector<Resource> aReads,
+                              std::vector<Resource> aWrites);
+    YTE_Shared void RemoveTask(TaskId aTask);
+
+    // Delivers what's been posted for aPhase (see EventHandler::PostEvent),
+    // runs every task in aPhase, then sends aEventName from the Engine.
+    YTE_Shared void RunPhase(FramePhase aPhase,
+                             EventId aEventName,
+                             LogicUpdate *aEvent);
+
+    // Accumulates this frame's timings and logs them every ReportInterval
+    // frames.
+    YTE_Shared void EndFrame();
+
+    bool IsEnabled() const
+    {
+      return mEnabled;
+    }
+
+    void SetEnabled(bool aEnabled)
+    {
+      mEnabled = aEnabled;
+    }
+
+    size_t GetReportInterval() const
+    {
+      return mReportInterval;
+    }
+
+    void SetReportInterval(size_t aFrames)
+    {
+      mReportInterval = aFrames;
+    }
+
+  private:
+    struct Task
+    {
+      TaskId mId;
+      std::string mName;
+      TaskFunction mFunction;
+      std::vector<Resource> mReads;
+      std::vector<Resource> mWrites;
+
+      // Indices of earlier tasks in the same phase.
+      std::vector<size_t> mDependencies;
+
+      // Seconds, written by whichever thread ran the task.
+      double mDuration = 0.0;
+    };
+
+    // Seconds, summed over the frames since the last report.
+    struct PhaseTimings
+    {
+      double mTasks = 0.0;
+      double mWork = 0.0;
+      double mCriticalPath = 0.0;
+      double mEvent = 0.0;
+    };
+
+    struct Phase
+    {
+      std::vector<Task> mTasks;
+      PhaseTimings mFrame;
+      PhaseTimings mTotal;
+      bool mDirty = false;
+    };
+
+    void BuildDependencies(Phase &aPhase);
+    void RunTasks(Phase &aPhase, LogicUpdate *aEvent);
+    void Report();
+
+    static void RunTask(Task &aTask, LogicUpdate *aEvent);
+
+    Engine *mEngine;
+    std::array<Phase, static_cast<size_t>(FramePhase::Count)> mPhases;
+    std::vector<JobHandle> mHandles;
+    std::vector<JobHandle> mDependencies;
+    TaskId mNextId;
+    size_t mReportInterval;
+    size_t mFramesSinceReport;
+    bool mEnabled;
+    bool mRunning;
+  };
+}
+
+#endif
@@ -0,0 +1,690 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "rapidjson/filereadstream.h"
+#include "rapidjson/reader.h"
+
+#include "YTE/Core/AssetLoader.hpp"
+#include "YTE/Core/BinaryDocument.hpp"
+#include "YTE/Core/Blueprint.hpp"
+#include "YTE/Core/Composition.hpp"
+#include "YTE/Core/Engine.hpp"
+#include "YTE/Core/LevelLoader.hpp"
+#include "YTE/Core/Threading/JobSystem.hpp"
+
+#include "YTE/Platform/MappedFile.hpp"
+
+namespace YTE
+{
+  namespace
+  {
+    size_t const cReadBufferSize = 64 * 1024;
+
+    // Where the JSON of the child compositions being read is kept, the
+    // allocator only goes to the heap for batches bigger than this.
+    size_t const cValueBufferSize = 64 * 1024;
+
+    // A batch of children is added once it has this many, or its JSON takes
+    // this much memory. Enough to keep every worker busy compiling them,
+    // without holding much more of the level than before.
+    size_t const cBatchCompositions = 256;
+    size_t const cBatchBytes = 4 * 1024 * 1024;
+
+    template <typename tHandler>
+    bool ReadJsonFile(std::string const &aPath, tHandler &aHandler, rapidjson::ParseResult &aResult)
+    {
+      FILE *file = fopen(aPath.c_str(), "rb");
+
+      if (nullptr == file)
+      {
+        return false;
+      }
+
+      std::vector<char> buffer(cReadBufferSize);
+      rapidjson::FileReadStream stream(file, buffer.data(), buffer.size());
+
+      rapidjson::Reader reader;
+      aResult = reader.Parse(stream, aHandler);
+
+      fclose(file);
+      return true;
+    }
+  }
+
+  bool ParseJsonFile(std::string const &aPath, RSDocument &aDocument)
+  {
+    FILE *file = fopen(aPath.c_str(), "rb");
+
+    if (nullptr == file)
+    {
+      return false;
+    }
+
+    std::vector<char> buffer(cReadBufferSize);
+    rapidjson::FileReadStream stream(file, buffer.data(), buffer.size());
+
+    aDocument.ParseStream(stream);
+
+    fclose(file);
+    return true;
+  }
+
+  // Receives the file from rapidjson's Reader. Keeps track of where it is in
+  // the root composition, and builds a value out of each of the root's
+  // components (on the first pass) or child compositions (on the second).
+  class LevelLoader::Handler
+  {
+  public:
+    enum class Pass
+    {
+      Components,
+      Compositions
+    };
+
+    struct RootComponent
+    {
+      std::string mTypeName;
+      RSValue mProperties;
+    };
+
+    Handler(LevelLoader *aLoader, Pass aPass, RSAllocator &aAllocator)
+      : mLoader(aLoader)
+      , mPass(aPass)
+      , mAllocator(aAllocator)
+      , mDepth(0)
+      , mMember(Member::Other)
+      , mCapturing(false)
+      , mFinished(false)
+      , mIsObject(false)
+      , mSeenArchetype(false)
+      , mSeenCompositions(false)
+      , mSeenComponents(false)
+      , mHasCompositions(false)
+      , mHasComponents(false)
+    {
+    }
+
+    // Anything other than Compositions and Components after the first of
+    // each is ignored, like looking them up in a document would.
+    bool IsObject() const { return mIsObject; }
+    bool HasCompositions() const { return mHasCompositions; }
+    bool HasComponents() const { return mHasComponents; }
+    bool HasArchetype() const { return mSeenArchetype; }
+    std::string const& GetArchetype() const { return mArchetype; }
+
+    std::vector<RootComponent>& GetComponents() { return mComponents; }
+
+    // The reader was stopped because this pass had everything it needed.
+    bool Finished() const { return mFinished; }
+
+    /////////////////////////////////////////////////////////////////////////
+    // rapidjson Handler
+    /////////////////////////////////////////////////////////////////////////
+    bool Null() { return Scalar([]() { return RSValue{}; }); }
+    bool Bool(bool aValue) { return Scalar([aValue]() { return RSValue{ aValue }; }); }
+    bool Int(int aValue) { return Scalar([aValue]() { return RSValue{ aValue }; }); }
+    bool Uint(unsigned aValue) { return Scalar([aValue]() { return RSValue{ aValue }; }); }
+    bool Int64(int64_t aValue) { return Scalar([aValue]() { return RSValue{ aValue }; }); }
+    bool Uint64(uint64_t aValue) { return Scalar([aValue]() { return RSValue{ aValue }; }); }
+    bool Double(double aValue) { return Scalar([aValue]() { return RSValue{ aValue }; }); }
+
+    // Only called when parsing with kParseNumbersAsStringsFlag.
+    bool RawNumber(const char *aString, RSSizeType aLength, bool aCopy)
+    {
+      return String(aString, aLength, aCopy);
+    }
+
+    bool String(const char *aString, RSSizeType aLength, bool)
+    {
+      if (false == mCapturing &&
+          1 == mDepth &&
+          Member::Archetype == mMember)
+      {
+        mArchetype.assign(aString, aLength);
+        return true;
+      }
+
+      return Scalar([this, aString, aLength]() { return RSValue{ aString, aLength, mAllocator }; });
+    }
+
+    bool StartObject()
+    {
+      return Start(rapidjson::kObjectType);
+    }
+
+    bool Key(const char *aString, RSSizeType aLength, bool)
+    {
+      if (mCapturing)
+      {
+        mStack.emplace_back(aString, aLength, mAllocator);
+      }
+      else if (1 == mDepth)
+      {
+        mMember = Classify(std::string{ aString, aLength });
+      }
+      else if (2 == mDepth)
+      {
+        mName.assign(aString, aLength);
+      }
+
+      return true;
+    }
+
+    bool EndObject(RSSizeType aMemberCount)
+    {
+      if (mCapturing)
+      {
+        auto first = mStack.end() - 2 * aMemberCount;
+        RSValue &object = *(first - 1);
+
+        for (auto it = first; it != mStack.end(); it += 2)
+        {
+          object.AddMember(*it, *(it + 1), mAllocator);
+        }
+
+        mStack.erase(first, mStack.end());
+      }
+
+      return End();
+    }
+
+    bool StartArray()
+    {
+      return Start(rapidjson::kArrayType);
+    }
+
+    bool EndArray(RSSizeType aElementCount)
+    {
+      if (mCapturing)
+      {
+        auto first = mStack.end() - aElementCount;
+        RSValue &array = *(first - 1);
+
+        array.Reserve(aElementCount, mAllocator);
+
+        for (auto it = first; it != mStack.end(); ++it)
+        {
+          array.PushBack(*it, mAllocator);
+        }
+
+        mStack.erase(first, mStack.end());
+      }
+
+      return End();
+    }
+
+  private:
+    enum class Member
+    {
+      Archetype,
+      Compositions,
+      Components,
+      Other
+    };
+
+    Member Classify(std::string const &aKey)
+    {
+      if (false == mSeenArchetype && "Archetype" == aKey)
+      {
+        mSeenArchetype = true;
+        return Member::Archetype;
+      }
+      else if (false == mSeenCompositions && "Compositions" == aKey)
+      {
+        mSeenCompositions = true;
+        return Member::Compositions;
+      }
+      else if (false == mSeenComponents && "Components" == aKey)
+      {
+        mSeenComponents = true;
+        return Member::Components;
+      }
+
+      return Member::Other;
+    }
+
+    // Whether the values in the root member we're in are built on this pass.
+    bool Wanted() const
+    {
+      return (Pass::Components == mPass && Member::Components == mMember) ||
+             (Pass::Compositions == mPass && Member::Compositions == mMember);
+    }
+
+    // Only makes the value if it's going to be kept, so the allocator isn't
+    // filled with everything this pass skips over.
+    template <typename tMakeValue>
+    bool Scalar(tMakeValue &&aMakeValue)
+    {
+      if (mCapturing)
+      {
+        mStack.emplace_back(aMakeValue());
+      }
+      else if (2 == mDepth && Wanted())
+      {
+        mStack.emplace_back(aMakeValue());
+        return Finish();
+      }
+
+      return true;
+    }
+
+    bool Start(rapidjson::Type aType)
+    {
+      if (mCapturing)
+      {
+        mStack.emplace_back(aType);
+      }
+      else if (0 == mDepth)
+      {
+        mIsObject = rapidjson::kObjectType == aType;
+
+        if (false == mIsObject)
+        {
+          return false;
+        }
+      }
+      else if (1 == mDepth)
+      {
+        // Their members are only looked at if they're objects.
+        if (rapidjson::kObjectType != aType)
+        {
+          mMember = Member::Other;
+        }
+
+        mHasCompositions = mHasCompositions || Member::Compositions == mMember;
+        mHasComponents = mHasComponents || Member::Components == mMember;
+      }
+      else if (2 == mDepth && Wanted())
+      {
+        mCapturing = true;
+        mStack.emplace_back(aType);
+      }
+
+      ++mDepth;
+      return true;
+    }
+
+    bool End()
+    {
+      --mDepth;
+
+      if (mCapturing)
+      {
+        if (2 == mDepth)
+        {
+          mCapturing = false;
+          return Finish();
+        }
+
+        return true;
+      }
+
+      // Everything after the root's compositions is only wanted on the first
+      // pass, so this one can stop reading.
+      if (1 == mDepth &&
+          Pass::Compositions == mPass &&
+          Member::Compositions == mMember)
+      {
+        mFinished = true;
+        return false;
+      }
+
+      return true;
+    }
+
+    // A component or child composition has been completely read.
+    bool Finish()
+    {
+      if (Pass::Components == mPass)
+      {
+        // Kept until the whole root has been checked, so nothing is added if
+        // it turns out not to be a composition. Only a handful of these.
+        mComponents.push_back(RootComponent{ mName, std::move(mStack.back()) });
+        mStack.clear();
+      }
+      else
+      {
+        mLoader->QueueComposition(mName, mStack.back(), mAllocator);
+        mStack.clear();
+      }
+
+      return true;
+    }
+
+    LevelLoader *mLoader;
+    Pass mPass;
+    RSAllocator &mAllocator;
+
+    // How many objects and arrays we're in, the root is 1.
+    int mDepth;
+    Member mMember;
+    bool mCapturing;
+    bool mFinished;
+
+    bool mIsObject;
+    bool mSeenArchetype;
+    bool mSeenCompositions;
+    bool mSeenComponents;
+    bool mHasCompositions;
+    bool mHasComponents;
+
+    // Name of the component or composition being read.
+    std::string mName;
+    std::string mArchetype;
+
+    // Values being built, each object or array is folded into the value
+    // below its members when it ends.
+    std::vector<RSValue> mStack;
+
+    std::vector<RootComponent> mComponents;
+  };
+
+  LevelLoader::LevelLoader(Composition *aRoot, JobSystem *aJobs)
+    : mRoot(aRoot)
+    , mJobs((nullptr != aJobs) ? aJobs : aRoot->GetEngine()->GetComponent<JobSystem>())
+  {
+  }
+
+  bool LevelLoader::Load(String const &aLevel)
+  {
+    auto path = Path::GetLevelPath(Path::GetGamePath(), aLevel.c_str());
+
+    if (false == std::experimental::filesystem::exists(path) &&
+        false == std::experimental::filesystem::exists(GetBinaryPath(path)))
+    {
+      path = Path::GetLevelPath(Path::GetEnginePath(), aLevel.c_str());
+    }
+
+    if (HasCurrentBinary(path))
+    {
+      return LoadBinaryFile(GetBinaryPath(path), aLevel);
+    }
+
+    return LoadFile(path, aLevel);
+  }
+
+  bool LevelLoader::LoadFile(std::string const &aPath, String const &aLevel)
+  {
+    YTEProfileFunction();
+
+    std::vector<char> valueBuffer(cValueBufferSize);
+    RSAllocator allocator{ valueBuffer.data(), valueBuffer.size() };
+    rapidjson::ParseResult result;
+
+    Handler components{ this, Handler::Pass::Components, allocator };
+
+    if (false == ReadJsonFile(aPath, components, result))
+    {
+      std::cout << "Could not find level " << aLevel << std::endl;
+      return false;
+    }
+
+    if (false == components.IsObject())
+    {
+      printf("We're trying to serialize something that isn't a composition: %s\n",
+             aLevel.c_str());
+      return false;
+    }
+
+    if (result.IsError())
+    {
+      std::cout << "Error in Level: " << aLevel << ", " << result.Code() << std::endl;
+      return false;
+    }
+
+    if (false == components.HasCompositions())
+    {
+      printf("We're trying to serialize something without Compositions: %s\n",
+             aLevel.c_str());
+      return false;
+    }
+
+    if (false == components.HasComponents())
+    {
+      printf("We're trying to serialize something without Components: %s\n",
+             aLevel.c_str());
+      return false;
+    }
+
+    for (auto &component : components.GetComponents())
+    {
+      AddComponent(Type::GetGlobalType(component.mTypeName), &component.mProperties);
+    }
+
+    OrderComponents();
+
+    components.GetComponents().clear();
+    allocator.Clear();
+
+    Handler compositions{ this, Handler::Pass::Compositions, allocator };
+
+    bool read = ReadJsonFile(aPath, compositions, result);
+
+    // Whatever was read before any error is still added, as it was when
+    // children were added one at a time.
+    AddCompositions();
+
+    if (false == read ||
+        (result.IsError() && false == compositions.Finished()))
+    {
+      std::cout << "Error in Level: " << aLevel << ", " << result.Code() << std::endl;
+      return false;
+    }
+
+    if (components.HasArchetype())
+    {
+      SetArchetypeName(components.GetArchetype());
+    }
+
+    return true;
+  }
+
+  void LevelLoader::AddComponent(BoundType *aType, RSValue *aProperties)
+  {
+    mRoot->AddComponent(aType, aProperties);
+  }
+
+  void LevelLoader::OrderComponents()
+  {
+    mRoot->OrderComponents();
+  }
+
+  void LevelLoader::QueueComposition(std::string const &aName,
+                                     RSValue &aValue,
+                                     RSAllocator &aAllocator)
+  {
+    mPending.push_back(PendingComposition{ aName.c_str(), std::move(aValue) });
+
+    if (cBatchCompositions <= mPending.size() || cBatchBytes <= aAllocator.Size())
+    {
+      AddCompositions();
+      aAllocator.Clear();
+    }
+  }
+
+  // Compiling a child does everything but make it: resolving component types
+  // and factories and converting property values. Nothing shared is written
+  // while compiling, so the batch is compiled in parallel. Making and
+  // attaching the compositions (which registers their GUIDs) stays on this
+  // thread, in the order they were in the file.
+  void LevelLoader::AddCompositions()
+  {
+    YTEProfileFunction();
+
+    if (mPending.empty())
+    {
+      return;
+    }
+
+    auto engine = mRoot->GetEngine();
+    std::vector<std::unique_ptr<Blueprint>> blueprints(mPending.size());
+
+    mJobs->ParallelFor(0, mPending.size(), 1, [&](size_t aIndex)
+    {
+      blueprints[aIndex] = std::make_unique<Blueprint>(engine, &mPending[aIndex].mValue);
+    });
+
+    for (size_t i = 0; i < mPending.size(); ++i)
+    {
+      auto &pending = mPending[i];
+
+      if (blueprints[i]->IsValid())
+      {
+        blueprints[i]->Instantiate(mRoot->EmplaceChild(pending.mName));
+      }
+      else
+      {
+        // Deserializing it says what's wrong with it.
+        mRoot->DeserializeChild(pending.mName, &pending.mValue);
+      }
+    }
+
+    mPending.clear();
+  }
+
+  void LevelLoader::SetArchetypeName(std::string const &aArchetypeName)
+  {
+    mRoot->mArchetypeName = aArchetypeName.c_str();
+  }
+
+  struct LevelLoader::BinaryLoad
+  {
+    BinaryLoad(BinaryDocument const &aDocument, RSAllocator &aAllocator, String const &aLevel)
+      : mDocument(aDocument)
+      , mAllocator(aAllocator)
+      , mTypes(aDocument.GetStringCount(), nullptr)
+      , mLevel(aLevel)
+    {
+    }
+
+    // Component types are looked up once per name in the string table,
+    // rather than once per component.
+    BoundType* GetType(u32 aName)
+    {
+      if (nullptr == mTypes[aName])
+      {
+        mTypes[aName] = Type::GetGlobalType(std::string{ mDocument.GetString(aName),
+                                                         mDocument.GetStringLength(aName) });
+      }
+
+      return mTypes[aName];
+    }
+
+    BinaryDocument const &mDocument;
+    RSAllocator &mAllocator;
+    std::vector<BoundType*> mTypes;
+    String const &mLevel;
+  };
+
+  bool LevelLoader::LoadBinaryFile(std::string const &aPath, String const &aLevel)
+  {
+    YTEProfileFunction();
+
+    MappedFile file{ aPath };
+
+    if (false == file.IsOpen())
+    {
+      std::cout << "Could not find level " << aLevel << std::endl;
+      return false;
+    }
+
+    BinaryDocument document{ file.GetData(), file.GetSize() };
+
+    if (false == document.IsValid())
+    {
+      std::cout << "Error in Level: " << aLevel << ", not a valid binary level" << std::endl;
+      return false;
+    }
+
+    std::vector<char> valueBuffer(cValueBufferSize);
+    RSAllocator allocator{ valueBuffer.data(), valueBuffer.size() };
+
+    BinaryLoad load{ document, allocator, aLevel };
+
+    return LoadBinaryRoot(load, document.GetRoot());
+  }
+
+  // Mirrors Composition::Deserialize. Only the values being deserialized are
+  // turned back into JSON (pointing into the file): each of the root's
+  // components, then its children a batch at a time, as LoadFile does.
+  bool LevelLoader::LoadBinaryRoot(BinaryLoad &aLoad, BinaryNode const *aNode)
+  {
+    auto &document = aLoad.mDocument;
+
+    if (BinaryKind::Object != aNode->mKind)
+    {
+      printf("We're trying to serialize something that isn't a composition: %s\n",
+             aLoad.mLevel.c_str());
+      return false;
+    }
+
+    auto compositions = document.FindMember(aNode, "Compositions");
+    auto components = document.FindMember(aNode, "Components");
+
+    if (nullptr == compositions || BinaryKind::Object != compositions->mKind)
+    {
+      printf("We're trying to serialize something without Compositions: %s\n",
+             aLoad.mLevel.c_str());
+      return false;
+    }
+
+    if (nullptr == components || BinaryKind::Object != components->mKind)
+    {
+      printf("We're trying to serialize something without Components: %s\n",
+             aLoad.mLevel.c_str());
+      return false;
+    }
+
+    auto name = BinaryDocument::GetFirstChild(components);
+
+    for (u32 i = 0; i < components->mCount; ++i)
+    {
+      auto value = BinaryDocument::GetNext(name);
+
+      RSValue properties;
+      document.ToJson(value, properties, aLoad.mAllocator, false);
+
+      AddComponent(aLoad.GetType(name->mCount), &properties);
+      aLoad.mAllocator.Clear();
+
+      name = BinaryDocument::GetNext(value);
+    }
+
+    OrderComponents();
+
+    name = BinaryDocument::GetFirstChild(compositions);
+
+    for (u32 i = 0; i < compositions->mCount; ++i)
+    {
+      auto value = BinaryDocument::GetNext(name);
+
+      RSValue child;
+      document.ToJson(value, child, aLoad.mAllocator, false);
+
+      QueueComposition(document.GetString(name->mCount), child, aLoad.mAllocator);
+
+      name = BinaryDocument::GetNext(value);
+    }
+
+    AddCompositions();
+    aLoad.mAllocator.Clear();
+
+    auto archetype = document.FindMember(aNode, "Archetype");
+
+    if (nullptr != archetype && BinaryKind::String == archetype->mKind)
+    {
+      SetArchetypeName(document.GetString(archetype->mCount));
+    }
+
+    return true;
+  }
+}
@@ -0,0 +1,81 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#pragma once
+
+#ifndef YTE_Core_LevelLoader_hpp
+#define YTE_Core_LevelLoader_hpp
+
+#include <string>
+#include <vector>
+
+#include "YTE/Core/ForwardDeclarations.hpp"
+#include "YTE/Core/Utilities.hpp"
+
+namespace YTE
+{
+  struct BinaryNode;
+
+  // Parses the file at aPath into aDocument as it's read, instead of reading
+  // the whole file into a string first. False if the file couldn't be
+  // opened, otherwise check aDocument.HasParseError().
+  YTE_Shared bool ParseJsonFile(std::string const &aPath, RSDocument &aDocument);
+
+  // Deserializes a level file into a composition (usually a Space) while
+  // reading it, instead of parsing the whole level into a document and then
+  // walking it. The root's child compositions are held as JSON a batch at a
+  // time: each batch is compiled into Blueprints in parallel on the
+  // JobSystem, then added to the root in order on this thread, and its
+  // memory is reused for the next one.
+  //
+  // The file is read twice: first for the root's own components, so they're
+  // created before any of its children as Composition::Deserialize does,
+  // then for the children.
+  //
+  // Levels saved with a binary form (see BinaryDocument) are read from that
+  // instead while it's up to date, straight from the mapped file.
+  class LevelLoader
+  {
+  public:
+    // Children are compiled on aJobs, or the engine's JobSystem if it's
+    // null.
+    YTE_Shared LevelLoader(Composition *aRoot, JobSystem *aJobs = nullptr);
+
+    // Looks for aLevel in the game's levels and then the engine's, as
+    // Engine::GetLevel does, preferring its binary form. aRoot should be
+    // empty.
+    YTE_Shared bool Load(String const &aLevel);
+
+    // aLevel is only used to say which level had problems.
+    YTE_Shared bool LoadFile(std::string const &aPath, String const &aLevel);
+    YTE_Shared bool LoadBinaryFile(std::string const &aPath, String const &aLevel);
+
+  private:
+    class Handler;
+    struct BinaryLoad;
+
+    void AddComponent(BoundType *aType, RSValue *aProperties);
+    void OrderComponents();
+    void QueueComposition(std::string const &aName, RSValue &aValue, RSAllocator &aAllocator);
+    void AddCompositions();
+    void SetArchetypeName(std::string const &aArchetypeName);
+    bool LoadBinaryRoot(BinaryLoad &aLoad, BinaryNode const *aNode);
+
+    struct PendingComposition
+    {
+      String mName;
+      RSValue mValue;
+    };
+
+    Composition *mRoot;
+    JobSystem *mJobs;
+
+    // Children read since the last batch was added, see QueueComposition.
+    std::vector<PendingComposition> mPending;
+  };
+}
+
+#endif
@@ -0,0 +1,168 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#include "YTE/Core/PostQueue.hpp"
+
+namespace YTE
+{
+  PostQueue::PostQueue(size_t aCapacity)
+    : mEnqueue(0)
+    , mDequeue(0)
+    , mOverflowed(false)
+  {
+    size_t capacity = 2;
+
+    while (capacity < aCapacity)
+    {
+      capacity <<= 1;
+    }
+
+    mCells = std::make_unique<Cell[]>(capacity);
+    mMask = capacity - 1;
+
+    for (size_t i = 0; i < capacity; ++i)
+    {
+      mCells[i].mSequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  PostQueue::~PostQueue()
+  {
+    size_t end = mEnqueue.load(std::memory_order_acquire);
+
+    for (size_t position = mDequeue; position != end; ++position)
+    {
+      Cell &cell = mCells[position & mMask];
+
+      if ((position + 1) == cell.mSequence.load(std::memory_order_acquire))
+      {
+        cell.mDispatch(nullptr, cell.mPayload.mBytes);
+      }
+    }
+
+    for (auto &overflow : mOverflow)
+    {
+      overflow.mDispatch(nullptr, overflow.mPayload->mBytes);
+    }
+  }
+
+  PostQueue::Cell* PostQueue::Claim(size_t &aPosition)
+  {
+    size_t position = mEnqueue.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+      Cell &cell = mCells[position & mMask];
+      size_t sequence = cell.mSequence.load(std::memory_order_acquire);
+      auto difference = static_cast<std::ptrdiff_t>(sequence - position);
+
+      if (0 == difference)
+      {
+        if (mEnqueue.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+        {
+          aPosition = position;
+          return &cell;
+        }
+      }
+      // The cell hasn't been delivered since the last time around, so we're full.
+      else if (difference < 0)
+      {
+        return nullptr;
+      }
+      else
+      {
+        position = mEnqueue.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  void PostQueue::PostOverflow(void *aTarget, Dispatch aDispatch, std::unique_ptr<Storage> aPayload)
+  {
+    std::lock_guard<std::mutex> lock(mOverflowLock);
+    mOverflow.emplace_back(Overflow{ aTarget, aDispatch, std::move(aPayload) });
+    mOverflowed.store(true, std::memory_order_release);
+  }
+
+  void PostQueue::Deliver()
+  {
+    size_t end = mEnqueue.load(std::memory_order_acquire);
+    size_t capacity = mMask + 1;
+
+    while (mDequeue != end)
+    {
+      Cell &cell = mCells[mDequeue & mMask];
+
+      if ((mDequeue + 1) != cell.mSequence.load(std::memory_order_acquire))
+      {
+        break;
+      }
+
+      // Advanced first, so a target destroyed while this is delivered
+      // doesn't Cancel the post we're already delivering.
+      size_t position = mDequeue++;
+
+      cell.mDispatch(cell.mTarget, cell.mPayload.mBytes);
+      cell.mSequence.store(position + capacity, std::memory_order_release);
+    }
+
+    if (false == mOverflowed.load(std::memory_order_acquire))
+    {
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mOverflowLock);
+      mDelivering.swap(mOverflow);
+      mOverflowed.store(false, std::memory_order_relaxed);
+    }
+
+    // By index, Cancel may be clearing targets as we go.
+    for (size_t i = 0; i < mDelivering.size(); ++i)
+    {
+      auto target = mDelivering[i].mTarget;
+      mDelivering[i].mTarget = nullptr;
+      mDelivering[i].mDispatch(target, mDelivering[i].mPayload->mBytes);
+    }
+
+    mDelivering.clear();
+  }
+
+  void PostQueue::Cancel(void *aTarget)
+  {
+    size_t end = mEnqueue.load(std::memory_order_acquire);
+
+    // Cells that aren't published yet can't be for aTarget, posting to an
+    // object must finish before it's destroyed.
+    for (size_t position = mDequeue; position != end; ++position)
+    {
+      Cell &cell = mCells[position & mMask];
+
+      if ((position + 1) == cell.mSequence.load(std::memory_order_acquire) &&
+          aTarget == cell.mTarget)
+      {
+        cell.mTarget = nullptr;
+      }
+    }
+
+    for (auto &post : mDelivering)
+    {
+      if (aTarget == post.mTarget)
+      {
+        post.mTarget = nullptr;
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(mOverflowLock);
+
+    for (auto &post : mOverflow)
+    {
+      if (aTarget == post.mTarget)
+      {
+        post.mTarget = nullptr;
+      }
+    }
+  }
+}
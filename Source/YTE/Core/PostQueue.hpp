@@ -0,0 +1,126 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#pragma once
+
+#ifndef YTE_Core_PostQueue_hpp
+#define YTE_Core_PostQueue_hpp
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace YTE
+{
+  // Many threads post, one thread (the one that owns the targets) delivers.
+  // Posts go into a fixed ring of cells, each with room to construct the
+  // payload in place, so posting is a compare and swap and a copy rather
+  // than a lock and an allocation. Only if the ring is full does a post fall
+  // back to a heap copy under a lock, those are delivered after the ring.
+  //
+  // Payloads are otherwise delivered in the order they were posted. A cell
+  // still being written blocks the ones after it until the next Deliver.
+  class PostQueue
+  {
+  public:
+    static constexpr size_t cPayloadSize = 128;
+    static constexpr size_t cDefaultCapacity = 256;
+
+    // Delivers the payload to aTarget and destroys it, or only destroys it
+    // if aTarget is null (it was cancelled).
+    using Dispatch = void(*)(void *aTarget, void *aPayload);
+
+    // aCapacity is rounded up to a power of two.
+    PostQueue(size_t aCapacity = cDefaultCapacity);
+
+    // Payloads never delivered are destroyed.
+    ~PostQueue();
+
+    PostQueue(PostQueue const&) = delete;
+    PostQueue& operator=(PostQueue const&) = delete;
+
+    // Any thread. Constructs a tPayload from aArguments to be handed to
+    // aDispatch on the delivering thread.
+    template <typename tPayload, typename... tArguments>
+    void Post(void *aTarget, Dispatch aDispatch, tArguments &&...aArguments)
+    {
+      static_assert(sizeof(tPayload) <= cPayloadSize,
+                    "The payload is too large to be posted, post something smaller (like a pointer to it).");
+      static_assert(alignof(tPayload) <= alignof(std::max_align_t),
+                    "The payload is over aligned.");
+
+      size_t position;
+
+      if (Cell *cell = Claim(position))
+      {
+        new (cell->mPayload.mBytes) tPayload(std::forward<tArguments>(aArguments)...);
+        cell->mTarget = aTarget;
+        cell->mDispatch = aDispatch;
+        cell->mSequence.store(position + 1, std::memory_order_release);
+        return;
+      }
+
+      auto storage = std::make_unique<Storage>();
+      new (storage->mBytes) tPayload(std::forward<tArguments>(aArguments)...);
+      PostOverflow(aTarget, aDispatch, std::move(storage));
+    }
+
+    // Delivering thread only. Delivers everything posted before the call,
+    // anything posted while delivering waits for the next call.
+    void Deliver();
+
+    // Delivering thread only. Posts already made to aTarget are destroyed
+    // without being delivered, for when it's destroyed before they are.
+    void Cancel(void *aTarget);
+
+  private:
+    struct Storage
+    {
+      alignas(std::max_align_t) unsigned char mBytes[cPayloadSize];
+    };
+
+    struct alignas(64) Cell
+    {
+      // Equal to the position it's next claimed at when free, one past the
+      // position it was claimed at once its payload is published.
+      std::atomic<size_t> mSequence;
+      void *mTarget;
+      Dispatch mDispatch;
+      Storage mPayload;
+    };
+
+    struct Overflow
+    {
+      void *mTarget;
+      Dispatch mDispatch;
+      std::unique_ptr<Storage> mPayload;
+    };
+
+    Cell* Claim(size_t &aPosition);
+    void PostOverflow(void *aTarget, Dispatch aDispatch, std::unique_ptr<Storage> aPayload);
+
+    std::unique_ptr<Cell[]> mCells;
+    size_t mMask;
+
+    alignas(64) std::atomic<size_t> mEnqueue;
+
+    // Only touched by the delivering thread.
+    alignas(64) size_t mDequeue;
+
+    std::mutex mOverflowLock;
+    std::atomic<bool> mOverflowed;
+    std::vector<Overflow> mOverflow;
+
+    // The overflow being delivered, only touched by the delivering thread.
+    std::vector<Overflow> mDelivering;
+  };
+}
+
+#endif
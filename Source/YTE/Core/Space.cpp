@@ -11,9 +11,11 @@ All content (c) 2016 DigiPen  (USA) Corporation, all rights reserved.
 #include <fstream>
 
 #include "YTE/Core/Actions/ActionManager.hpp"
+#include "YTE/Core/BinaryDocument.hpp"
 #include "YTE/Core/Component.hpp"
 #include "YTE/Core/Composition.hpp"
 #include "YTE/Core/Engine.hpp"
+#include "YTE/Core/LevelLoader.hpp"
 #include "YTE/Core/Space.hpp"
 #include "YTE/Core/AssetLoader.hpp"
 
@@ -63,7 +65,6 @@ namespace YTE
 
   Space::Space(Engine* aEngine, RSValue* aProperties)
     : Composition(aEngine, this, aEngine)
-    , mLevelToLoad(nullptr)
   {
     if (false == mEngine->IsEditor())
     {
@@ -133,7 +134,7 @@ namespace YTE
     }
     else
     {
-      Load(mEngine->GetLevel(mStartingLevel));
+      Load(mStartingLevel);
       mLevelName = mStartingLevel;
     }
   }
@@ -154,7 +155,31 @@ namespace YTE
     {
       printf("We could not deserialize the level provided.\n");
     }
-      
+
+    FinishLoading(aInitialize);
+  }
+
+  // Loads a level into the current Space from its file, creating objects as
+  // the file is read. If already loaded, destroys the current Space and
+  // loads level in place.
+  void Space::Load(String const &aLevelName, bool aInitialize)
+  {
+    YTEProfileFunction();
+    mCompositions.Clear();
+    ComponentClear();
+
+    LevelLoader loader{ this };
+
+    if (false == loader.Load(aLevelName))
+    {
+      printf("We could not deserialize the level provided.\n");
+    }
+
+    FinishLoading(aInitialize);
+  }
+
+  void Space::FinishLoading(bool aInitialize)
+  {
     if (aInitialize)
     {
       Initialize();
@@ -252,7 +277,7 @@ namespace YTE
     {
       mLevelName = mLoadingName;
       SetName(mLoadingName);
-      Load(mLevelToLoad, false);
+      Load(mLoadingName, false);
     }
 
     if (false == mFinishedLoading)
@@ -300,6 +325,10 @@ namespace YTE
   // Cleans up anything in the Space.
   Space::~Space() 
   {
+    // Here rather than in ~Composition, so the registry is still around
+    // while they're removed from it.
+    mCompositions.Clear();
+    ComponentClear();
   }
 
   void Space::CreateBlankLevel(String const& aLevelName)
@@ -332,7 +361,6 @@ namespace YTE
   {
     mCheckRunInEditor = aCheckRunInEditor;
     mLoading = true;
-    mLevelToLoad = mEngine->GetLevel(level);
     mLoadingName = level;
   }
 
@@ -361,14 +389,62 @@ namespace YTE
     levelToSave.open(level);
     levelToSave << levelInJson;
     levelToSave.close();
+
+    // Written after the JSON so it's as new, and is what gets loaded.
+    WriteBinaryFile(GetBinaryPath(std::experimental::filesystem::path{ level }.string()), value);
   }
 
 
+  void Space::GatherComponents(Space *aSpace,
+                               Composition *aComposition,
+                               Type *aType,
+                               std::vector<Component*> &aComponents)
+  {
+    for (auto const& [name, composition] : aComposition->GetCompositions())
+    {
+      // Child spaces keep their own.
+      if (composition->GetSpace() == aSpace)
+      {
+        GatherComponents(aSpace, composition.get(), aType, aComponents);
+      }
+    }
+
+    auto component = aComposition->GetComponent(aType);
+
+    if (nullptr != component)
+    {
+      aComponents.emplace_back(component);
+    }
+  }
+
+  std::vector<Component*> const& Space::GetTrackedComponents(Type *aType)
+  {
+    if (auto tracked = mComponentRegistry.Find(aType))
+    {
+      return *tracked;
+    }
+
+    std::vector<Component*> components;
+    GatherComponents(this, this, aType, components);
+
+    return mComponentRegistry.Track(aType, std::move(components));
+  }
+
+  ComponentSystem* Space::GetComponentSystem()
+  {
+    return mEngine->GetComponent<ComponentSystem>();
+  }
+
+  JobSystem* Space::GetJobSystem()
+  {
+    return mEngine->GetComponent<JobSystem>();
+  }
+
   Space* Space::AddChildSpace(String aLevelName)
   {
     auto newSpace = AddComposition<Space>(aLevelName, mEngine, nullptr);
     newSpace->mOwner = this;
-    newSpace->Load(mEngine->GetLevel(aLevelName));
+    newSpace->Load(aLevelName);
     auto ourView = GetComponent<GraphicsView>();
     auto newView = newSpace->GetComponent<GraphicsView>();
 
@@ -7,13 +7,17 @@
 #ifndef YTE_Core_Space_hpp
 #define YTE_Core_Space_hpp
 
+#include <tuple>
+
 #include "YTE/Core/EventHandler.hpp"
 
 #include "YTE/Platform/DeviceEnums.hpp"
 #include "YTE/Platform/Window.hpp"
 
+#include "YTE/Core/ComponentRegistry.hpp"
 #include "YTE/Core/Composition.hpp"
 #include "YTE/Core/ForwardDeclarations.hpp"
+#include "YTE/Core/Threading/JobSystem.hpp"
 
 namespace YTE
 {
@@ -27,6 +31,7 @@ namespace YTE
     YTE_Shared Space(Engine *aEngine, RSValue *aProperties);
     YTE_Shared void Load();
     YTE_Shared void Load(RSValue *aLevel, bool aInitialize = true);
+    YTE_Shared void Load(String const &aLevelName, bool aInitialize = true);
     YTE_Shared void Update(LogicUpdate *aEvent);
     YTE_Shared ~Space();
 
@@ -47,18 +52,105 @@ namespace YTE
     YTE_Shared bool GetIsEditorSpace() { return mIsEditorSpace; }
     YTE_Shared void SetIsEditorSpace(bool aIsEditorSpace) { mIsEditorSpace = aIsEditorSpace; }
   
-    RSValue *mLevelToLoad;
-
     bool GetFinishedLoading()
     {
       return mFinishedLoading;
     }
 
+    // Calls aFunction(tComponentType*, tOthers*...) for every component of
+    // exactly tComponentType in this space whose composition also has a
+    // component of each of tOthers. Walks tComponentType's pool in memory
+    // order rather than the composition tree, so the order isn't the
+    // tree's.
+    template <typename tComponentType, typename... tOthers, typename tFunction>
+    void ForEach(tFunction &&aFunction)
+    {
+      auto pool = GetComponentSystem()->GetComponentPool<tComponentType>();
+
+      if (nullptr == pool)
+      {
+        return;
+      }
+
+      pool->ForEach([this, &aFunction](tComponentType *aComponent)
+      {
+        VisitIfComplete<tOthers...>(aComponent, aFunction);
+      });
+    }
+
+    // As ForEach, but the pool's chunks are split across the JobSystem's
+    // workers. Nothing may add or remove components of tComponentType
+    // until it returns.
+    template <typename tComponentType, typename... tOthers, typename tFunction>
+    void ParallelForEach(tFunction &&aFunction)
+    {
+      auto pool = GetComponentSystem()->GetComponentPool<tComponentType>();
+
+      if (nullptr == pool)
+      {
+        return;
+      }
+
+      GetJobSystem()->ParallelFor(0, pool->GetChunkCount(), 1, [this, pool, &aFunction](size_t aChunk)
+      {
+        pool->ForEachInChunk(aChunk, [this, &aFunction](tComponentType *aComponent)
+        {
+          VisitIfComplete<tOthers...>(aComponent, aFunction);
+        });
+      });
+    }
+
+    // Every component of exactly aType in this space. The first call for a
+    // type walks the tree, after that the list is kept up to date as
+    // components are added and removed. Don't add or remove components of
+    // aType while iterating it.
+    YTE_Shared std::vector<Component*> const& GetTrackedComponents(Type *aType);
+
+    template <typename tComponentType, typename tFunction>
+    void ForEachTracked(tFunction &&aFunction)
+    {
+      for (auto component : GetTrackedComponents(TypeId<tComponentType>()))
+      {
+        aFunction(static_cast<tComponentType*>(component));
+      }
+    }
+
+    ComponentRegistry& GetComponentRegistry() { return mComponentRegistry; }
+
+    YTE_Shared ComponentSystem* GetComponentSystem();
+    YTE_Shared JobSystem* GetJobSystem();
+
   private:
+    template <typename... tOthers, typename tComponentType, typename tFunction>
+    void VisitIfComplete(tComponentType *aComponent, tFunction &aFunction)
+    {
+      if (this != aComponent->GetSpace())
+      {
+        return;
+      }
+
+      auto owner = aComponent->GetOwner();
+      auto others = std::make_tuple(owner->template GetComponent<tOthers>()...);
+
+      std::apply([aComponent, &aFunction](auto *...aOthers)
+      {
+        if ((... && (nullptr != aOthers)))
+        {
+          aFunction(aComponent, aOthers...);
+        }
+      }, others);
+    }
+
     void WindowLostOrGainedFocusHandler(const WindowFocusLostOrGained *aEvent);
     void WindowMinimizedOrRestoredHandler(const WindowMinimizedOrRestored *aEvent);
 
+    void FinishLoading(bool aInitialize);
+
     static void ConnectNodes(Space* aSpace, Composition* aComposition);
+    static void GatherComponents(Space *aSpace,
+                                 Composition *aComposition,
+                                 Type *aType,
+                                 std::vector<Component*> &aComponents);
 
     String mLoadingName;
     String mLevelName;
@@ -69,6 +161,8 @@ namespace YTE
     IntrusiveList<Composition> mPhysicsInitialize;
     IntrusiveList<Composition> mInitialize;
     IntrusiveList<Composition> mStart;
+
+    ComponentRegistry mComponentRegistry;
       
     bool mPaused = false;
     bool mPriorToMinimize = false;
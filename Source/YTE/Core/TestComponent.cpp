@@ -45,7 +45,7 @@ namespace YTE
 
     mTime = mCurrentPosition.z < 0.0f ? glm::pi<float>() : 0.0f;
 
-    mSpace->RegisterEvent<&TestComponent::Update>(Events::LogicUpdate, this);
+    mSpace->RegisterTick<&TestComponent::Update>(Events::LogicUpdate, this);
   }
 
   void TestComponent::Update(LogicUpdate *aEvent)
@@ -0,0 +1,82 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#include "YTE/Core/Threading/FiberPool.hpp"
+
+namespace YTE
+{
+  FiberPool::FiberPool(Fiber::EntryPoint aEntryPoint, size_t aStackSize)
+    : mEntryPoint(aEntryPoint)
+    , mStackSize(aStackSize)
+    , mReadyCount(0)
+  {
+  }
+
+  FiberPool::~FiberPool()
+  {
+  }
+
+  Fiber* FiberPool::Acquire()
+  {
+    std::lock_guard<std::mutex> lock(mLock);
+
+    if (false == mFree.empty())
+    {
+      Fiber *fiber = mFree.back();
+      mFree.pop_back();
+      return fiber;
+    }
+
+    auto fiber = std::make_unique<Fiber>(mEntryPoint, nullptr, mStackSize);
+
+    if (false == fiber->IsValid())
+    {
+      return nullptr;
+    }
+
+    mFibers.emplace_back(std::move(fiber));
+    return mFibers.back().get();
+  }
+
+  void FiberPool::Release(Fiber *aFiber)
+  {
+    std::lock_guard<std::mutex> lock(mLock);
+    mFree.push_back(aFiber);
+  }
+
+  void FiberPool::MakeReady(Fiber *aFiber)
+  {
+    std::lock_guard<std::mutex> lock(mLock);
+    mReady.push_back(aFiber);
+    mReadyCount.store(mReady.size(), std::memory_order_seq_cst);
+  }
+
+  Fiber* FiberPool::PopReady()
+  {
+    if (0 == mReadyCount.load(std::memory_order_relaxed))
+    {
+      return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(mLock);
+
+    if (mReady.empty())
+    {
+      return nullptr;
+    }
+
+    Fiber *fiber = mReady.front();
+    mReady.pop_front();
+    mReadyCount.store(mReady.size(), std::memory_order_relaxed);
+
+    return fiber;
+  }
+
+  size_t FiberPool::ReadyCount() const
+  {
+    return mReadyCount.load(std::memory_order_relaxed);
+  }
+}
@@ -0,0 +1,53 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "YTE/Platform/Fiber.hpp"
+
+namespace YTE
+{
+  // Every fiber the workers run on. Free fibers are sitting at the top of the
+  // worker loop, ready to take over a thread whose fiber is waiting on a job.
+  // Ready fibers are waiting fibers whose job has completed, any worker may
+  // resume them.
+  class FiberPool
+  {
+  public:
+    // New fibers run aEntryPoint(nullptr) on a stack of aStackSize bytes.
+    FiberPool(Fiber::EntryPoint aEntryPoint, size_t aStackSize);
+
+    // Fibers still suspended (only possible if the job they were waiting on
+    // was abandoned) are dropped without being unwound.
+    ~FiberPool();
+
+    // Returns nullptr if a new fiber was needed and couldn't be created.
+    Fiber* Acquire();
+    void Release(Fiber *aFiber);
+
+    void MakeReady(Fiber *aFiber);
+    Fiber* PopReady();
+
+    // Lock free, so it may be stale by the time it's used.
+    size_t ReadyCount() const;
+
+  private:
+    Fiber::EntryPoint mEntryPoint;
+    size_t mStackSize;
+
+    mutable std::mutex mLock;
+    std::vector<std::unique_ptr<Fiber>> mFibers;
+    std::vector<Fiber*> mFree;
+    std::deque<Fiber*> mReady;
+    std::atomic<size_t> mReadyCount;
+  };
+}
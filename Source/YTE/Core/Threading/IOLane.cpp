@@ -0,0 +1,83 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#include "YTE/Core/Threading/IOLane.hpp"
+
+namespace YTE
+{
+  IOLane::IOLane()
+    : mStopping(false)
+  {
+  }
+
+  IOLane::~IOLane()
+  {
+    Stop();
+  }
+
+  void IOLane::Start(size_t aThreads)
+  {
+    mStopping = false;
+
+    for (size_t i = 0; i < aThreads; ++i)
+    {
+      mThreads.emplace_back([this]() { Run(); });
+    }
+  }
+
+  void IOLane::Stop()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mWakeLock);
+      mStopping = true;
+    }
+
+    mWake.notify_all();
+
+    for (auto &thread : mThreads)
+    {
+      if (thread.joinable())
+      {
+        thread.join();
+      }
+    }
+
+    mThreads.clear();
+    mQueue.Flush();
+  }
+
+  void IOLane::Queue(Job *aJob)
+  {
+    mQueue.Push(aJob);
+
+    // Taking the lock orders the push against a thread that's about to wait.
+    {
+      std::lock_guard<std::mutex> lock(mWakeLock);
+    }
+
+    mWake.notify_one();
+  }
+
+  void IOLane::Run()
+  {
+    while (true)
+    {
+      if (Job *job = mQueue.Pop())
+      {
+        job->Invoke();
+        continue;
+      }
+
+      std::unique_lock<std::mutex> lock(mWakeLock);
+      mWake.wait(lock, [this]() { return mStopping || 0 != mQueue.Size(); });
+
+      if (mStopping)
+      {
+        return;
+      }
+    }
+  }
+}
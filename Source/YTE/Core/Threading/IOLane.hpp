@@ -0,0 +1,46 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "YTE/Core/Threading/LockedJobQueue.hpp"
+
+namespace YTE
+{
+  // Threads dedicated to JobPriority::IO jobs: file loads, imports, anything
+  // that blocks or runs for a long time. They're separate from the worker
+  // pool and never steal from it or get stolen from, so a multi-second load
+  // can't hold up a frame. They sleep on a condition variable rather than
+  // spin, since IO jobs are rare and latency doesn't matter much.
+  class IOLane
+  {
+  public:
+    IOLane();
+    ~IOLane();
+
+    void Start(size_t aThreads);
+
+    // Waits for the jobs already running, anything still queued is
+    // abandoned.
+    void Stop();
+
+    void Queue(Job *aJob);
+
+  private:
+    void Run();
+
+    LockedJobQueue mQueue;
+    std::vector<std::thread> mThreads;
+    std::mutex mWakeLock;
+    std::condition_variable mWake;
+    bool mStopping;
+  };
+}
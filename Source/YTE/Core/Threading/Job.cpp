@@ -7,34 +7,106 @@ All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
 
 #include "YTE/Core/Threading/Job.hpp"
 #include "YTE/Core/Threading/JobHandle.hpp"
+#include "YTE/Core/Threading/JobPool.hpp"
+#include "YTE/Core/Threading/JobSystem.hpp"
 
 namespace YTE
 {
-  Job::Job(std::function<Any(JobHandle&)>&& aDelegate)
-    : mParentJob(nullptr)
-    , mDelegate(std::move(aDelegate))
-    , mReturn()
-    , mTotalJobs(0)
-    , mUnfinishedJobs(0)
-    , mAbandoned(std::make_shared<bool>(false))
+  Job::ContinuationNode Job::cContinuationsClosed{ nullptr, nullptr };
+
+  static thread_local JobPriority tCurrentPriority = JobPriority::Normal;
+
+  Job* Job::Create(JobSystem *aSystem,
+                   JobPool *aPool, 
+                   Function &&aDelegate, 
+                   JobPriority aPriority,
+                   JobHandle *aParentHandle)
   {
-    IncrementJobs();
+    Job *parent = aParentHandle ? aParentHandle->GetJob() : nullptr;
+    void *memory = aPool ? aPool->Allocate() : ::operator new(sizeof(Job));
+
+    if (parent)
+    {
+      aPriority = parent->GetPriority();
+    }
+
+    return new (memory) Job(aSystem, std::move(aDelegate), parent, aPool, aPriority);
   }
 
-  Job::Job(std::function<Any(JobHandle&)>&& aDelegate, JobHandle& aParentHandle)
-    : mParentJob(aParentHandle.GetJob())
+  JobPriority Job::CurrentPriority()
+  {
+    return tCurrentPriority;
+  }
+
+  void Job::SetCurrentPriority(JobPriority aPriority)
+  {
+    tCurrentPriority = aPriority;
+  }
+
+  Job::Job(JobSystem *aSystem, 
+           Function &&aDelegate, 
+           Job *aParentJob, 
+           JobPool *aPool, 
+           JobPriority aPriority)
+    : mSystem(aSystem)
+    , mParentJob(aParentJob)
+    , mPool(aPool)
     , mDelegate(std::move(aDelegate))
     , mReturn()
     , mTotalJobs(0)
     , mUnfinishedJobs(0)
-    , mAbandoned(std::make_shared<bool>(false))
+    , mReferences(1)
+    , mDependencies(0)
+    , mContinuations(nullptr)
+    , mAbandoned(false)
+    , mPriority(aPriority)
+    , mQueuedAt(0)
   {
+    if (mParentJob)
+    {
+      mParentJob->AddReference();
+    }
+
     IncrementJobs();
   }
 
   Job::~Job()
   {
-    Abandon();
+    // Only jobs that never ran (abandoned) still have continuations here.
+    auto node = mContinuations.load();
+
+    while (nullptr != node && &cContinuationsClosed != node)
+    {
+      auto next = node->mNext;
+      node->mJob->RemoveReference();
+      delete node;
+      node = next;
+    }
+
+    if (mParentJob)
+    {
+      mParentJob->RemoveReference();
+    }
+  }
+
+  JobSystem* Job::GetSystem()
+  {
+    return mSystem;
+  }
+
+  JobPriority Job::GetPriority() const
+  {
+    return mPriority;
+  }
+
+  u64 Job::GetQueuedAt() const
+  {
+    return mQueuedAt;
+  }
+
+  void Job::SetQueuedAt(u64 aTime)
+  {
+    mQueuedAt = aTime;
   }
 
   JobHandle Job::GetParentHandle()
@@ -52,9 +124,9 @@ namespace YTE
     return static_cast<float>(mTotalJobs - mUnfinishedJobs) / mTotalJobs;
   }
 
-  bool Job::IsDeletable() const
+  bool Job::WasAbandoned() const
   {
-    return (1 == mAbandoned.use_count()) && (HasCompleted() || *mAbandoned);
+    return mAbandoned;
   }
 
   Any Job::GetReturn()
@@ -62,10 +134,22 @@ namespace YTE
     return mReturn;
   }
 
+  void Job::SetReturn(Any &&aReturn)
+  {
+    mReturn = std::move(aReturn);
+  }
+
   void Job::Invoke()
   {
+    // Jobs can be run from inside of others (waiting without a fiber, or
+    // RunForeground), so restore rather than reset.
+    JobPriority previous = tCurrentPriority;
+    tCurrentPriority = mPriority;
+
     JobHandle handle(this);
-    mReturn = mDelegate(handle);
+    mDelegate.Invoke(handle);
+
+    tCurrentPriority = previous;
     DecrementJobs();
   }
 
@@ -81,21 +165,97 @@ namespace YTE
 
   void Job::DecrementJobs()
   {
-    --mUnfinishedJobs;
-    if (mParentJob)
+    // Completing may release this job, but the parent can't complete (and
+    // so can't be released) until we've decremented it below.
+    Job *parent = mParentJob;
+
+    if (1 == mUnfinishedJobs.fetch_sub(1))
     {
-      mParentJob->DecrementJobs();
+      RunContinuations();
+      RemoveReference();
+    }
+
+    if (parent)
+    {
+      parent->DecrementJobs();
     }
   }
 
   void Job::Abandon()
   {
-    *mAbandoned = true;
+    mAbandoned = true;
   }
 
-  std::weak_ptr<bool> Job::GetAbandonedHandle()
+  void Job::AddReference()
   {
-    return mAbandoned;
+    mReferences.fetch_add(1, std::memory_order_relaxed);
   }
 
+  void Job::SetDependencies(int aCount)
+  {
+    mDependencies = aCount;
+  }
+
+  void Job::DependencyCompleted()
+  {
+    // Only the transition to zero schedules, so a job waiting on any one of
+    // several dependencies ignores the ones that complete after it's queued.
+    if (1 == mDependencies.fetch_sub(1))
+    {
+      mSystem->ScheduleReady(this);
+    }
+  }
+
+  void Job::AddContinuation(Job *aContinuation)
+  {
+    auto node = new ContinuationNode{ aContinuation, mContinuations.load() };
+    aContinuation->AddReference();
+
+    do
+    {
+      if (&cContinuationsClosed == node->mNext)
+      {
+        delete node;
+        aContinuation->DependencyCompleted();
+        aContinuation->RemoveReference();
+        return;
+      }
+    } while (false == mContinuations.compare_exchange_weak(node->mNext, node));
+  }
+
+  void Job::RunContinuations()
+  {
+    auto node = mContinuations.exchange(&cContinuationsClosed);
+
+    while (nullptr != node)
+    {
+      auto next = node->mNext;
+
+      node->mJob->DependencyCompleted();
+      node->mJob->RemoveReference();
+      delete node;
+
+      node = next;
+    }
+  }
+
+  void Job::RemoveReference()
+  {
+    if (1 != mReferences.fetch_sub(1, std::memory_order_acq_rel))
+    {
+      return;
+    }
+
+    JobPool *pool = mPool;
+    this->~Job();
+
+    if (pool)
+    {
+      pool->Free(this);
+    }
+    else
+    {
+      ::operator delete(this);
+    }
+  }
 }
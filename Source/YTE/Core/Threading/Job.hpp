@@ -11,39 +11,122 @@ All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
 #include "YTE/Core/ForwardDeclarations.hpp"
 #include "YTE/Core/Utilities.hpp"
 
-#include "YTE/StandardLibrary/Delegate.hpp"
-
-#include <functional>
+#include "YTE/StandardLibrary/FunctionDelegate.hpp"
 
 namespace YTE
 {
+  class JobPool;
+
+  // Workers always run the most urgent job they can find, so frame work never
+  // waits behind Normal or Background jobs queued before it. IO jobs never
+  // reach the workers at all, they run on the JobSystem's I/O lane, whose
+  // threads are free to block on disk or spend seconds in an import.
+  enum class JobPriority
+  {
+    FrameCritical,
+    Normal,
+    Background,
+    IO
+  };
+
+  // Priorities run by the workers, each has its own set of queues.
+  constexpr size_t cWorkerPriorities = static_cast<size_t>(JobPriority::IO);
+
+  // Jobs are reference counted: the JobSystem holds one reference until the
+  // job and all of its children have completed, and every JobHandle holds
+  // another. When the last one is dropped the job goes back to the pool it
+  // was allocated from.
+  //
+  // A job may also have continuations, jobs waiting on this one (and maybe
+  // others) to complete before they're queued. See JobSystem::QueueJobAfter.
   class Job
   {
+    friend class Worker;
   public:
-    Job(std::function<Any(JobHandle&)>&& aDelegate);
-    Job(std::function<Any(JobHandle&)>&& aDelegate, JobHandle& aParentHandle);
-    ~Job();
+    using Function = FunctionDelegate<void(*)(JobHandle&)>;
+
+    // Allocates from aPool when given (must be called on the pool's owning
+    // thread), otherwise from the heap. Children take their parent's
+    // priority rather than aPriority.
+    static Job* Create(JobSystem *aSystem,
+                       JobPool *aPool, 
+                       Function &&aDelegate, 
+                       JobPriority aPriority,
+                       JobHandle *aParentHandle = nullptr);
+
+    // The priority of the job running on this thread, or Normal if there
+    // isn't one. Jobs queued without a priority get this one.
+    YTE_Shared static JobPriority CurrentPriority();
+
+    JobSystem* GetSystem();
+    JobPriority GetPriority() const;
+
+    // When the job was last queued (see TelemetryNow), or 0 if nobody was
+    // tracking latency at the time.
+    u64 GetQueuedAt() const;
+    void SetQueuedAt(u64 aTime);
 
     JobHandle GetParentHandle();
     bool HasCompleted() const;
     float Progress() const;
-    bool IsDeletable() const;
+    bool WasAbandoned() const;
 
     Any GetReturn();
+    void SetReturn(Any &&aReturn);
     void Invoke();
 
     void IncrementJobs();
     void DecrementJobs();
 
     void Abandon();
-    std::weak_ptr<bool> GetAbandonedHandle();
+
+    void AddReference();
+    void RemoveReference();
+
+    // The job will be handed to the JobSystem once aCount more dependencies
+    // have completed. Call before adding it as a continuation of anything.
+    void SetDependencies(int aCount);
+    void DependencyCompleted();
+
+    // Queues aContinuation's DependencyCompleted for when this job completes,
+    // or calls it now if this job already has.
+    void AddContinuation(Job *aContinuation);
 
   protected:
+    struct ContinuationNode
+    {
+      Job *mJob;
+      ContinuationNode *mNext;
+    };
+
+    Job(JobSystem *aSystem, 
+        Function &&aDelegate, 
+        Job *aParentJob, 
+        JobPool *aPool, 
+        JobPriority aPriority);
+    ~Job();
+
+    void RunContinuations();
+
+    // For workers moving a job that waited between threads.
+    static void SetCurrentPriority(JobPriority aPriority);
+
+    // Marks the continuation list once it's been run, later additions run
+    // immediately.
+    static ContinuationNode cContinuationsClosed;
+
+    JobSystem *mSystem;
     Job* mParentJob;
-    std::function<Any(JobHandle&)> mDelegate;
+    JobPool *mPool;
+    Function mDelegate;
     Any mReturn;
     std::atomic<int> mTotalJobs;
     std::atomic<int> mUnfinishedJobs;
-    std::shared_ptr<bool> mAbandoned;
+    std::atomic<int> mReferences;
+    std::atomic<int> mDependencies;
+    std::atomic<ContinuationNode*> mContinuations;
+    std::atomic<bool> mAbandoned;
+    JobPriority mPriority;
+    u64 mQueuedAt;
   };
 }
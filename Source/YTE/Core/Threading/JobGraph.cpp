@@ -0,0 +1,34 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#include "YTE/Core/Threading/JobGraph.hpp"
+
+namespace YTE
+{
+  JobHandle JobGraph::Run(JobSystem *aSystem)
+  {
+    mHandles.clear();
+    mHandles.reserve(mNodes.size());
+
+    std::vector<JobHandle> dependencies;
+
+    for (auto &node : mNodes)
+    {
+      dependencies.clear();
+
+      for (auto dependency : node.mDependencies)
+      {
+        dependencies.emplace_back(mHandles[dependency]);
+      }
+
+      mHandles.emplace_back(aSystem->QueueJobAfter(dependencies, std::move(node.mFunction)));
+    }
+
+    mNodes.clear();
+
+    return aSystem->WhenAll(mHandles);
+  }
+}
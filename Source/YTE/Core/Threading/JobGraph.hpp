@@ -0,0 +1,71 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#pragma once
+
+#include <initializer_list>
+#include <vector>
+
+#include "YTE/Core/Threading/JobSystem.hpp"
+
+namespace YTE
+{
+  // Declarative description of a set of jobs and the order they depend on
+  // each other in. Nodes may only depend on nodes added before them, so the
+  // graph can't have cycles. Run queues every node as a continuation of its
+  // dependencies, so nothing blocks waiting between stages.
+  //
+  //   JobGraph graph;
+  //   auto load = graph.Add([](JobHandle&) { /* load mesh */ });
+  //   auto collider = graph.Add([](JobHandle&) { /* build collider */ }, { load });
+  //   graph.Add([](JobHandle&) { /* create model */ }, { load, collider });
+  //   auto done = graph.Run(jobSystem);
+  class JobGraph
+  {
+  public:
+    using Node = size_t;
+
+    template <typename tFunction>
+    Node Add(tFunction &&aFunction, std::initializer_list<Node> aDependencies = {})
+    {
+      for (auto dependency : aDependencies)
+      {
+        DebugObjection(mNodes.size() <= dependency,
+                       "JobGraph nodes may only depend on nodes added before them.");
+      }
+
+      mNodes.emplace_back(JobSystem::MakeJobFunction(std::forward<tFunction>(aFunction)), 
+                          aDependencies);
+      return mNodes.size() - 1;
+    }
+
+    // Queues every node, the graph is left empty. The returned handle
+    // completes once every node has.
+    YTE_Shared JobHandle Run(JobSystem *aSystem);
+
+    // Handles to the nodes queued by the last call to Run.
+    JobHandle GetHandle(Node aNode)
+    {
+      return mHandles[aNode];
+    }
+
+  private:
+    struct NodeData
+    {
+      NodeData(Job::Function &&aFunction, std::initializer_list<Node> aDependencies)
+        : mFunction(std::move(aFunction))
+        , mDependencies(aDependencies)
+      {
+      }
+
+      Job::Function mFunction;
+      std::vector<Node> mDependencies;
+    };
+
+    std::vector<NodeData> mNodes;
+    std::vector<JobHandle> mHandles;
+  };
+}
@@ -1,42 +1,101 @@
-#include "JobHandle.hpp"
 /******************************************************************************/
 /*!
 \author Evan T. Collier
 All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
 */
 /******************************************************************************/
+#include "YTE/Core/Threading/JobHandle.hpp"
 
 namespace YTE
 {
+  JobHandle::JobHandle()
+    : mJob(nullptr)
+  {
+  }
+
   JobHandle::JobHandle(Job * aJob)
     : mJob(aJob)
-    , mAbandoned(aJob ? aJob->GetAbandonedHandle().lock() : std::make_shared<bool>(false))
   {
+    if (mJob)
+    {
+      mJob->AddReference();
+    }
+  }
+
+  JobHandle::JobHandle(const JobHandle &aHandle)
+    : JobHandle(aHandle.mJob)
+  {
+  }
+
+  JobHandle::JobHandle(JobHandle &&aHandle)
+    : mJob(aHandle.mJob)
+  {
+    aHandle.mJob = nullptr;
+  }
+
+  JobHandle::~JobHandle()
+  {
+    if (mJob)
+    {
+      mJob->RemoveReference();
+    }
+  }
+
+  JobHandle& JobHandle::operator=(const JobHandle &aHandle)
+  {
+    if (aHandle.mJob)
+    {
+      aHandle.mJob->AddReference();
+    }
+
+    if (mJob)
+    {
+      mJob->RemoveReference();
+    }
+
+    mJob = aHandle.mJob;
+    return *this;
+  }
+
+  JobHandle& JobHandle::operator=(JobHandle &&aHandle)
+  {
+    if (this != &aHandle)
+    {
+      if (mJob)
+      {
+        mJob->RemoveReference();
+      }
+
+      mJob = aHandle.mJob;
+      aHandle.mJob = nullptr;
+    }
+
+    return *this;
   }
 
   bool JobHandle::HasParentHandle() const
   {
-    return !mJob->GetParentHandle().IsEmpty();
+    return mJob && !mJob->GetParentHandle().IsEmpty();
   }
 
   JobHandle JobHandle::GetParentHandle()
   {
-    return *mAbandoned ? nullptr : mJob->GetParentHandle();
+    return (mJob && !mJob->WasAbandoned()) ? mJob->GetParentHandle() : JobHandle();
   }
 
   bool JobHandle::HasCompleted() const
   {
-    return *mAbandoned ? false : mJob->HasCompleted();
+    return (mJob && !mJob->WasAbandoned()) ? mJob->HasCompleted() : false;
   }
 
   float JobHandle::Progress() const
   {
-    return *mAbandoned ? false : mJob->Progress();
+    return (mJob && !mJob->WasAbandoned()) ? mJob->Progress() : 0.0f;
   }
 
   bool JobHandle::WasAbandoned() const
   {
-    return *mAbandoned;
+    return mJob && mJob->WasAbandoned();
   }
 
   bool JobHandle::IsEmpty() const
@@ -46,13 +105,19 @@ namespace YTE
 
   Any JobHandle::GetReturn()
   {
-    return *mAbandoned ? Any() : mJob->GetReturn();
+    return (mJob && !mJob->WasAbandoned()) ? mJob->GetReturn() : Any();
   }
 
-  Job * JobHandle::GetJob()
+  void JobHandle::SetReturn(Any &&aReturn)
   {
-    return mJob;
+    if (mJob)
+    {
+      mJob->SetReturn(std::move(aReturn));
+    }
   }
 
+  Job * JobHandle::GetJob() const
+  {
+    return mJob;
+  }
 }
-
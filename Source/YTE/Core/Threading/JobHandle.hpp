@@ -13,21 +13,35 @@ namespace YTE
   class JobHandle
   {
     friend class Job;
+    friend class JobSystem;
+    friend class Worker;
   public:
-    JobHandle() {};
-    JobHandle(Job* aJob);
-    bool HasParentHandle() const;
-    JobHandle GetParentHandle();
-    bool HasCompleted() const;
-    float Progress() const;
-    bool WasAbandoned() const;
-    bool IsEmpty() const;
-    Any GetReturn();
+    YTE_Shared JobHandle();
+    YTE_Shared JobHandle(Job* aJob);
+    YTE_Shared JobHandle(const JobHandle &aHandle);
+    YTE_Shared JobHandle(JobHandle &&aHandle);
+    YTE_Shared ~JobHandle();
+
+    YTE_Shared JobHandle& operator=(const JobHandle &aHandle);
+    YTE_Shared JobHandle& operator=(JobHandle &&aHandle);
+
+    YTE_Shared bool HasParentHandle() const;
+    YTE_Shared JobHandle GetParentHandle();
+    YTE_Shared bool HasCompleted() const;
+    YTE_Shared float Progress() const;
+    YTE_Shared bool WasAbandoned() const;
+    YTE_Shared bool IsEmpty() const;
+    YTE_Shared Any GetReturn();
+    YTE_Shared void SetReturn(Any &&aReturn);
+
+    // Queues aFunction to run once this job (and its children) complete.
+    // Defined in JobSystem.hpp.
+    template <typename tFunction>
+    JobHandle Then(tFunction &&aFunction);
 
   private:
-    Job* GetJob();
+    Job* GetJob() const;
 
     Job* mJob;
-    std::shared_ptr<bool> mAbandoned;
   };
 }
@@ -0,0 +1,78 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#include "YTE/Core/Threading/JobPool.hpp"
+
+namespace YTE
+{
+  JobPool::JobPool()
+    : mLocalFree(nullptr)
+    , mRemoteFree(nullptr)
+    , mReferences(1)
+  {
+  }
+
+  JobPool::~JobPool()
+  {
+  }
+
+  void* JobPool::Allocate()
+  {
+    if (nullptr == mLocalFree)
+    {
+      mLocalFree = mRemoteFree.exchange(nullptr, std::memory_order_acquire);
+    }
+
+    if (nullptr == mLocalFree)
+    {
+      mBlocks.emplace_back(std::make_unique<Storage[]>(cJobsPerBlock));
+      auto block = mBlocks.back().get();
+
+      for (size_t i = 0; i < cJobsPerBlock; ++i)
+      {
+        auto node = reinterpret_cast<FreeNode*>(block + i);
+        node->mNext = mLocalFree;
+        mLocalFree = node;
+      }
+    }
+
+    FreeNode *node = mLocalFree;
+    mLocalFree = node->mNext;
+
+    mReferences.fetch_add(1, std::memory_order_relaxed);
+    return static_cast<void*>(node);
+  }
+
+  void JobPool::Free(void *aJob)
+  {
+    auto node = static_cast<FreeNode*>(aJob);
+    node->mNext = mRemoteFree.load(std::memory_order_relaxed);
+
+    // Only the owner ever pops, and it takes the whole list, so a plain CAS
+    // push can't suffer from ABA.
+    while (false == mRemoteFree.compare_exchange_weak(node->mNext,
+                                                      node,
+                                                      std::memory_order_release,
+                                                      std::memory_order_relaxed))
+    {
+    }
+
+    RemoveReference();
+  }
+
+  void JobPool::ReleaseOwner()
+  {
+    RemoveReference();
+  }
+
+  void JobPool::RemoveReference()
+  {
+    if (1 == mReferences.fetch_sub(1, std::memory_order_acq_rel))
+    {
+      delete this;
+    }
+  }
+}
@@ -0,0 +1,56 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "YTE/Core/Threading/Job.hpp"
+
+namespace YTE
+{
+  // Per worker storage for Jobs, so queueing a job doesn't touch the heap
+  // once the pool has warmed up. Only the owning worker allocates, but a job
+  // is freed by whichever thread drops its last reference. Those frees go to
+  // a lock-free list that the owner takes over all at once when its local
+  // list runs dry. The pool is reference counted by its owner and by every
+  // job it has handed out, so handles may outlive the worker.
+  class JobPool
+  {
+  public:
+    JobPool();
+
+    // Owner only.
+    void* Allocate();
+
+    // Any thread.
+    void Free(void *aJob);
+
+    // Called by the owning worker instead of deleting the pool.
+    void ReleaseOwner();
+
+  private:
+    ~JobPool();
+
+    struct FreeNode
+    {
+      FreeNode *mNext;
+    };
+
+    using Storage = std::aligned_storage_t<sizeof(Job), alignof(Job)>;
+    static constexpr size_t cJobsPerBlock = 64;
+
+    void RemoveReference();
+
+    FreeNode *mLocalFree;
+    std::atomic<FreeNode*> mRemoteFree;
+    std::atomic<size_t> mReferences;
+    std::vector<std::unique_ptr<Storage[]>> mBlocks;
+  };
+}
@@ -9,6 +9,18 @@ All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
 
 namespace YTE
 {
+  JobQueue::JobQueue(size_t aCapacity)
+    : mTop(0)
+    , mBottom(0)
+    , mBuffer(nullptr)
+  {
+    DebugObjection(0 == aCapacity || 0 != (aCapacity & (aCapacity - 1)),
+                   "JobQueue capacity must be a power of two.");
+
+    mBuffers.emplace_back(std::make_unique<Buffer>(aCapacity));
+    mBuffer.store(mBuffers.back().get(), std::memory_order_relaxed);
+  }
+
   JobQueue::~JobQueue()
   {
     Flush();
@@ -16,46 +28,114 @@ namespace YTE
 
   void JobQueue::Push(Job* aJob)
   {
-    std::lock_guard<std::mutex> guard(mQueueLock);
-    mQueue.push_back(aJob);
+    i64 bottom = mBottom.load(std::memory_order_relaxed);
+    i64 top = mTop.load(std::memory_order_acquire);
+    Buffer *buffer = mBuffer.load(std::memory_order_relaxed);
+
+    if (static_cast<i64>(buffer->Capacity()) <= (bottom - top))
+    {
+      buffer = Grow(buffer, bottom, top);
+    }
+
+    buffer->Put(bottom, aJob);
+    std::atomic_thread_fence(std::memory_order_release);
+    mBottom.store(bottom + 1, std::memory_order_relaxed);
   }
 
   Job* JobQueue::Pop()
   {
-    std::unique_lock<std::mutex> guard(mQueueLock);
-    if (mQueue.empty())
+    i64 bottom = mBottom.load(std::memory_order_relaxed) - 1;
+    Buffer *buffer = mBuffer.load(std::memory_order_relaxed);
+    mBottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    i64 top = mTop.load(std::memory_order_relaxed);
+
+    // Queue was already empty, restore the bottom.
+    if (bottom < top)
     {
-      guard.unlock();
+      mBottom.store(bottom + 1, std::memory_order_relaxed);
       return nullptr;
     }
-    Job* ret = mQueue.back();
-    mQueue.pop_back();
-    guard.unlock();
-    return ret;
+
+    Job *job = buffer->Get(bottom);
+
+    // More than one element left, no thief can be contending for this one.
+    if (top < bottom)
+    {
+      return job;
+    }
+
+    // Last element, race any thieves for it.
+    if (false == mTop.compare_exchange_strong(top,
+                                              top + 1,
+                                              std::memory_order_seq_cst,
+                                              std::memory_order_relaxed))
+    {
+      job = nullptr;
+    }
+
+    mBottom.store(bottom + 1, std::memory_order_relaxed);
+    return job;
   }
 
   Job* JobQueue::Steal()
   {
-    std::unique_lock<std::mutex> guard(mQueueLock);
-    if (mQueue.empty())
+    i64 top = mTop.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    i64 bottom = mBottom.load(std::memory_order_acquire);
+
+    if (bottom <= top)
     {
-      guard.unlock();
       return nullptr;
     }
-    Job* ret = mQueue.front();
-    mQueue.pop_front();
-    guard.unlock();
-    return ret;
+
+    Buffer *buffer = mBuffer.load(std::memory_order_acquire);
+    Job *job = buffer->Get(top);
+
+    if (false == mTop.compare_exchange_strong(top,
+                                              top + 1,
+                                              std::memory_order_seq_cst,
+                                              std::memory_order_relaxed))
+    {
+      return nullptr;
+    }
+
+    return job;
   }
 
   void JobQueue::Flush()
   {
-    std::lock_guard<std::mutex> guard(mQueueLock);
-    for (auto& job : mQueue)
+    while (Job *job = Pop())
     {
       job->Abandon();
-      delete job;
+      job->RemoveReference();
+    }
+  }
+
+  size_t JobQueue::Size() const
+  {
+    i64 bottom = mBottom.load(std::memory_order_relaxed);
+    i64 top = mTop.load(std::memory_order_relaxed);
+
+    return (top < bottom) ? static_cast<size_t>(bottom - top) : 0;
+  }
+
+  JobQueue::Buffer* JobQueue::Grow(Buffer *aBuffer, i64 aBottom, i64 aTop)
+  {
+    auto newBuffer = std::make_unique<Buffer>(aBuffer->Capacity() * 2);
+
+    for (i64 i = aTop; i < aBottom; ++i)
+    {
+      newBuffer->Put(i, aBuffer->Get(i));
     }
-    mQueue.clear();
+
+    Buffer *toReturn = newBuffer.get();
+
+    // Thieves may still be reading from the old buffer, so it stays alive
+    // until the queue is destroyed.
+    mBuffers.emplace_back(std::move(newBuffer));
+    mBuffer.store(toReturn, std::memory_order_release);
+
+    return toReturn;
   }
 }
@@ -6,26 +6,77 @@ All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
 /******************************************************************************/
 #pragma once
 
-#include <deque>
-#include <mutex>
+#include <atomic>
+#include <memory>
+#include <vector>
 
 #include "YTE/Core/Threading/Job.hpp"
 
-//TODO (Evan): Replace JobQueue with circular array
-// less locks and more performant
 namespace YTE
 {
+  // Lock-free work-stealing deque (Chase-Lev, with the C11 memory orderings
+  // from Le et al. 2013). The owning worker is the only thread allowed to
+  // Push and Pop, both of which work on the bottom of the queue. Any other
+  // worker may Steal from the top. The backing circular array doubles when
+  // full; retired arrays are kept alive until the queue is destroyed since a
+  // thief may still be reading from them.
   class JobQueue
   {
   public:
-    ~JobQueue();
-    void Push(Job* aJob);
-    Job* Pop();
-    Job* Steal();
+    YTE_Shared JobQueue(size_t aCapacity = 256);
+    YTE_Shared ~JobQueue();
+
+    // Owner only.
+    YTE_Shared void Push(Job* aJob);
+    YTE_Shared Job* Pop();
+
+    // Any thread. Returns nullptr if the queue was empty or if we lost the
+    // race for the top element to another thief or the owner.
+    YTE_Shared Job* Steal();
+
+    // Owner only, and only when no thieves can be running.
     void Flush();
+
+    // Approximate when called from anyone but the owner.
+    YTE_Shared size_t Size() const;
+
   private:
-    std::mutex mQueueLock;
-    std::deque<Job*> mQueue;
-  };
+    class Buffer
+    {
+    public:
+      Buffer(size_t aCapacity)
+        : mMask(aCapacity - 1)
+        , mData(std::make_unique<std::atomic<Job*>[]>(aCapacity))
+      {
+      }
 
+      size_t Capacity() const
+      {
+        return mMask + 1;
+      }
+
+      Job* Get(i64 aIndex) const
+      {
+        return mData[aIndex & mMask].load(std::memory_order_relaxed);
+      }
+
+      void Put(i64 aIndex, Job* aJob)
+      {
+        mData[aIndex & mMask].store(aJob, std::memory_order_relaxed);
+      }
+
+    private:
+      size_t mMask;
+      std::unique_ptr<std::atomic<Job*>[]> mData;
+    };
+
+    Buffer* Grow(Buffer *aBuffer, i64 aBottom, i64 aTop);
+
+    // Top and bottom are written by different threads, keep them on separate
+    // cache lines.
+    alignas(64) std::atomic<i64> mTop;
+    alignas(64) std::atomic<i64> mBottom;
+    alignas(64) std::atomic<Buffer*> mBuffer;
+    std::vector<std::unique_ptr<Buffer>> mBuffers;
+  };
 }
@@ -4,12 +4,15 @@
 All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
 */
 /******************************************************************************/
+#include <algorithm>
 #include <chrono>
 #include <vector>
 
 #include "YTE/Core/Engine.hpp"
 #include "YTE/Core/Threading/JobSystem.hpp"
 
+#include "YTE/Platform/Processors.hpp"
+
 namespace YTE
 {
   YTEDefineType(JobSystem)
@@ -23,6 +26,22 @@ namespace YTE
     : Component(aOwner, nullptr)
     , mForegroundWorker()
     , mPool()
+    , mParker()
+    , mInjected()
+    , mIOLane()
+    , mFibers(&Worker::FiberMain, cFiberStackSize)
+    , mReportBaseline()
+    , mFrameBaseline()
+    , mReportInterval(0)
+    , mFramesSinceReport(0)
+    , mTrackLatency(false)
+    , mWorkerCount(-1)
+    , mReservedProcessors()
+    , mAffinity()
+    , mIOThreads(2)
+    , mPinWorkers(false)
+    , mSpanNumaNodes(false)
+    , mSingleThreaded(false)
     , mAsync(false)
   {
     
@@ -30,6 +49,10 @@ namespace YTE
 
   JobSystem::~JobSystem()
   {
+    // Loads still running finish first, their continuations may need the
+    // workers.
+    mIOLane.Stop();
+
     for (auto& worker : mPool)
     {
       worker.second->Join();
@@ -44,16 +67,54 @@ namespace YTE
   void JobSystem::Initialize()
   {
     mOwner->RegisterEvent<&JobSystem::Update>(Events::FrameUpdate, this);
-    size_t workerCount = std::thread::hardware_concurrency();
+
+    bool restricted = false;
+    std::vector<size_t> processors = GetWorkerProcessors(restricted);
+    size_t workerCount = 0;
+
+    if (mSingleThreaded)
+    {
+      mIOThreads = 0;
+    }
+    else if (0 <= mWorkerCount)
+    {
+      workerCount = static_cast<size_t>(mWorkerCount);
+    }
+    else if (false == mAffinity.empty())
+    {
+      workerCount = mAffinity.size();
+    }
+    else if (false == processors.empty())
+    {
+      workerCount = processors.size() - 1;
+    }
+
     std::vector<Worker*> workers;
 
-    for (auto i = 0; i < workerCount - 1; ++i)
+    for (size_t i = 0; i < workerCount; ++i)
     {
-      workers.push_back(new BackgroundWorker());
+      auto worker = new BackgroundWorker(&mParker, mInjected.data(), &mFibers);
+
+      if (false == mAffinity.empty())
+      {
+        worker->SetAffinity({ mAffinity[i % mAffinity.size()] });
+      }
+      else if (mPinWorkers && false == processors.empty())
+      {
+        worker->SetAffinity({ processors[i % processors.size()] });
+      }
+      else if (restricted)
+      {
+        worker->SetAffinity(processors);
+      }
+
+      workers.push_back(worker);
     }
 
     mAsync = !workers.empty();
-    workers.push_back(new ForegroundWorker(mAsync));
+    auto foreground = new ForegroundWorker(&mParker, mInjected.data(), &mFibers, mAsync);
+    mForegroundWorker = foreground->GetID();
+    workers.push_back(foreground);
 
     for (auto& worker : workers)
     {
@@ -68,25 +129,128 @@ namespace YTE
 
     for (auto& worker : workers)
     {
+      worker->SetTrackLatency(mTrackLatency);
       worker->Init();
       Worker::WorkerID id = worker->GetID();
       mPool.insert(std::make_pair(id, worker));
     }
+
+    mWorkers = std::move(workers);
+    mIOLane.Start(mIOThreads);
+
+    mReportBaseline = Snapshot();
+    mFrameBaseline = mReportBaseline;
+  }
+
+  // Processor indices, anything that isn't one is skipped.
+  static std::vector<size_t> ReadProcessors(RSValue &aValue)
+  {
+    std::vector<size_t> processors;
+
+    if (false == aValue.IsArray())
+    {
+      return processors;
+    }
+
+    for (auto it = aValue.Begin(); it < aValue.End(); ++it)
+    {
+      if (it->IsUint())
+      {
+        processors.push_back(it->GetUint());
+      }
+    }
+
+    return processors;
+  }
+
+  void JobSystem::Deserialize(RSValue *aValue)
+  {
+    if (false == aValue->IsObject())
+    {
+      return;
+    }
+
+    if (aValue->HasMember("Workers") && (*aValue)["Workers"].IsUint())
+    {
+      mWorkerCount = static_cast<int>((*aValue)["Workers"].GetUint());
+    }
+
+    if (aValue->HasMember("ReservedProcessors"))
+    {
+      mReservedProcessors = ReadProcessors((*aValue)["ReservedProcessors"]);
+    }
+
+    if (aValue->HasMember("Affinity"))
+    {
+      mAffinity = ReadProcessors((*aValue)["Affinity"]);
+    }
+
+    if (aValue->HasMember("PinWorkers") && (*aValue)["PinWorkers"].IsBool())
+    {
+      mPinWorkers = (*aValue)["PinWorkers"].GetBool();
+    }
+
+    if (aValue->HasMember("SpanNumaNodes") && (*aValue)["SpanNumaNodes"].IsBool())
+    {
+      mSpanNumaNodes = (*aValue)["SpanNumaNodes"].GetBool();
+    }
+
+    if (aValue->HasMember("IOThreads") && (*aValue)["IOThreads"].IsUint())
+    {
+      mIOThreads = (*aValue)["IOThreads"].GetUint();
+    }
+
+    if (aValue->HasMember("SingleThreaded") && (*aValue)["SingleThreaded"].IsBool())
+    {
+      mSingleThreaded = (*aValue)["SingleThreaded"].GetBool();
+    }
+
+    if (false == aValue->HasMember("Telemetry"))
+    {
+      return;
+    }
+
+    auto &telemetry = (*aValue)["Telemetry"];
+
+    if (false == telemetry.IsObject())
+    {
+      return;
+    }
+
+    if (telemetry.HasMember("TrackLatency") && telemetry["TrackLatency"].IsBool())
+    {
+      SetTrackLatency(telemetry["TrackLatency"].GetBool());
+    }
+
+    if (telemetry.HasMember("ReportInterval") && telemetry["ReportInterval"].IsUint())
+    {
+      mReportInterval = telemetry["ReportInterval"].GetUint();
+    }
   }
 
   void JobSystem::WaitThisThread(JobHandle & aJobHandle)
   {
+    if (aJobHandle.IsEmpty())
+    {
+      return;
+    }
+
     auto it = mPool.find(std::this_thread::get_id());
     if (it != mPool.end())
     {
       it->second->Wait(aJobHandle);
+      return;
+    }
+
+    // Not one of ours (likely the I/O lane), so there's nothing to help with.
+    while (false == aJobHandle.HasCompleted())
+    {
+      std::this_thread::yield();
     }
   }
 
   void JobSystem::Update(LogicUpdate *aUpdate)
   {
-    UnusedArguments(aUpdate);
-
     if (std::this_thread::get_id() == mForegroundWorker)
     {
       auto it = mPool.find(mForegroundWorker);
@@ -96,24 +260,289 @@ namespace YTE
       }
     }
 
-    // Clean up any jobs that can be freed
-    for (auto& worker : mPool)
+    // Also called with no event to run foreground jobs, that's not a frame.
+    if (nullptr == aUpdate)
+    {
+      return;
+    }
+
+    if constexpr (YTE_CAN_PROFILE)
+    {
+      ProfileFrame();
+    }
+
+    ++mFramesSinceReport;
+
+    if (0 != mReportInterval && mReportInterval <= mFramesSinceReport)
+    {
+      mOwner->GetEngine()->Log(LogType::Information, ToString(GetTelemetry()));
+      ResetTelemetry();
+    }
+  }
+
+  JobSystemTelemetry JobSystem::GetTelemetry()
+  {
+    return Difference(Snapshot(), mReportBaseline);
+  }
+
+  void JobSystem::ResetTelemetry()
+  {
+    mReportBaseline = Snapshot();
+    mFramesSinceReport = 0;
+
+    for (auto worker : mWorkers)
+    {
+      worker->ResetMaxQueueDepth();
+    }
+  }
+
+  void JobSystem::SetTrackLatency(bool aTrack)
+  {
+    mTrackLatency = aTrack;
+
+    for (auto worker : mWorkers)
     {
-      worker.second->Clean();
+      worker->SetTrackLatency(aTrack);
     }
   }
 
-  void JobSystem::QueueJobInternal(Job * aJob)
+  std::vector<size_t> JobSystem::GetWorkerProcessors(bool &aRestricted)
+  {
+    std::vector<size_t> processors;
+    auto available = GetProcessors();
+    aRestricted = false;
+
+    if (available.empty())
+    {
+      // Couldn't ask, assume we can run anywhere.
+      for (size_t i = 0; i < std::thread::hardware_concurrency(); ++i)
+      {
+        available.push_back(ProcessorInformation{ i, 0 });
+      }
+    }
+
+    size_t current = GetCurrentProcessor();
+    size_t node = available.front().mNumaNode;
+    bool multipleNodes = false;
+
+    for (auto &processor : available)
+    {
+      if (processor.mIndex == current)
+      {
+        node = processor.mNumaNode;
+      }
+
+      multipleNodes = multipleNodes || (processor.mNumaNode != available.front().mNumaNode);
+    }
+
+    for (auto &processor : available)
+    {
+      bool reserved = mReservedProcessors.end() != std::find(mReservedProcessors.begin(),
+                                                             mReservedProcessors.end(),
+                                                             processor.mIndex);
+
+      // Memory is allocated on the node of the thread touching it first, and
+      // that's mostly the main thread. Crossing nodes costs more than the
+      // extra workers would gain us.
+      bool remote = multipleNodes && false == mSpanNumaNodes && processor.mNumaNode != node;
+
+      if (reserved || remote)
+      {
+        aRestricted = true;
+        continue;
+      }
+
+      processors.push_back(processor.mIndex);
+    }
+
+    // The main thread is on current, so pin workers everywhere else first.
+    auto it = std::find(processors.begin(), processors.end(), current);
+
+    if (it != processors.end())
+    {
+      std::rotate(processors.begin(), it + 1, processors.end());
+    }
+
+    return processors;
+  }
+
+  JobSystemTelemetry JobSystem::Snapshot()
+  {
+    JobSystemTelemetry telemetry;
+    telemetry.mWorkers.reserve(mWorkers.size());
+
+    for (auto worker : mWorkers)
+    {
+      telemetry.mWorkers.emplace_back(worker->GetTelemetry());
+    }
+
+    return telemetry;
+  }
+
+  JobSystemTelemetry JobSystem::Difference(JobSystemTelemetry const &aNow, 
+                                           JobSystemTelemetry const &aBefore)
+  {
+    JobSystemTelemetry difference = aNow;
+
+    for (size_t i = 0; i < difference.mWorkers.size() && i < aBefore.mWorkers.size(); ++i)
+    {
+      auto &now = difference.mWorkers[i];
+      auto &before = aBefore.mWorkers[i];
+
+      now.mBusySeconds -= before.mBusySeconds;
+      now.mIdleSeconds -= before.mIdleSeconds;
+      now.mJobsExecuted -= before.mJobsExecuted;
+      now.mStealsAttempted -= before.mStealsAttempted;
+      now.mStealsSucceeded -= before.mStealsSucceeded;
+
+      // The max queue depth is reset rather than diffed.
+      for (size_t j = 0; j < LatencyHistogram::cBuckets; ++j)
+      {
+        now.mLatency.mBuckets[j] -= before.mLatency.mBuckets[j];
+      }
+    }
+
+    return difference;
+  }
+
+  void JobSystem::ProfileFrame()
+  {
+    auto now = Snapshot();
+    auto frame = Difference(now, mFrameBaseline).Total();
+    mFrameBaseline = std::move(now);
+
+    YTEProfileValue("JobSystem Utilization", frame.Utilization());
+    YTEProfileValue("JobSystem Jobs", frame.mJobsExecuted);
+    YTEProfileValue("JobSystem Steals", frame.mStealsSucceeded);
+    YTEProfileValue("JobSystem Steal Attempts", frame.mStealsAttempted);
+    YTEProfileValue("JobSystem Max Queue Depth", frame.mMaxQueueDepth);
+    YTEProfileValue("JobSystem Latency p50 (us)", frame.mLatency.Percentile(0.5));
+    YTEProfileValue("JobSystem Latency p99 (us)", frame.mLatency.Percentile(0.99));
+  }
+
+  JobHandle JobSystem::WhenAll(std::vector<JobHandle> const &aJobs)
+  {
+    return QueueJobAfterInternal(Job::Function([](JobHandle&) {}), 
+                                 aJobs, 
+                                 aJobs.size(), 
+                                 Job::CurrentPriority());
+  }
+
+  JobHandle JobSystem::WhenAny(std::vector<JobHandle> const &aJobs)
+  {
+    return QueueJobAfterInternal(Job::Function([](JobHandle&) {}), 
+                                 aJobs, 
+                                 std::min<size_t>(aJobs.size(), 1),
+                                 Job::CurrentPriority());
+  }
+
+  void JobSystem::ScheduleReady(Job *aJob)
+  {
+    if (JobPriority::IO == aJob->GetPriority() && 0 != mIOThreads)
+    {
+      mIOLane.Queue(aJob);
+    }
+    else if (JobPriority::IO == aJob->GetPriority())
+    {
+      // No I/O threads (we're single threaded), the load runs now instead.
+      aJob->Invoke();
+    }
+    else if (auto worker = GetWorkerThisThread())
+    {
+      worker->Queue(aJob);
+    }
+    else if (mAsync)
+    {
+      if (mTrackLatency)
+      {
+        aJob->SetQueuedAt(TelemetryNow());
+      }
+
+      mInjected[static_cast<size_t>(aJob->GetPriority())].Push(aJob);
+      mParker.UnparkOne();
+    }
+    else
+    {
+      // Without background workers nothing would pick it up until the main
+      // thread waits, so just run it.
+      aJob->Invoke();
+    }
+  }
+
+  Worker* JobSystem::GetWorkerThisThread()
   {
     auto it = mPool.find(std::this_thread::get_id());
-    if (it != mPool.end())
+    return (it != mPool.end()) ? it->second : nullptr;
+  }
+
+  bool JobSystem::CanRunInParallel()
+  {
+    return mAsync && (nullptr != GetWorkerThisThread());
+  }
+
+  JobHandle JobSystem::QueueJobAfterInternal(Job::Function &&aFunction,
+                                             std::vector<JobHandle> const &aDependencies,
+                                             size_t aRequired,
+                                             JobPriority aPriority)
+  {
+    Worker *worker = GetWorkerThisThread();
+
+    Job *job = Job::Create(this,
+                           worker ? worker->GetJobPool() : nullptr,
+                           std::move(aFunction),
+                           aPriority);
+    JobHandle handle(job);
+
+    // One extra dependency guards against the job being scheduled while
+    // we're still adding it to its dependencies.
+    job->SetDependencies(static_cast<int>(aRequired) + 1);
+
+    for (auto &dependency : aDependencies)
     {
-      it->second->Queue(aJob);
+      if (dependency.IsEmpty())
+      {
+        job->DependencyCompleted();
+      }
+      else
+      {
+        dependency.GetJob()->AddContinuation(job);
+      }
+    }
+
+    job->DependencyCompleted();
+
+    return handle;
+  }
+
+  JobHandle JobSystem::QueueJobInternal(Job::Function &&aFunction, 
+                                        JobHandle *aParentHandle,
+                                        JobPriority aPriority)
+  {
+    Worker *worker = GetWorkerThisThread();
+
+    Job *job = Job::Create(this,
+                           worker ? worker->GetJobPool() : nullptr, 
+                           std::move(aFunction), 
+                           aPriority,
+                           aParentHandle);
+    JobHandle handle(job);
+
+    // We've already looked the worker up, skip doing it again in the common
+    // case.
+    if (worker && JobPriority::IO != job->GetPriority())
+    {
+      worker->Queue(job);
+    }
+    else
+    {
+      ScheduleReady(job);
     }
 
     if (!mAsync)
     {
       Update(nullptr);
     }
+
+    return handle;
   }
 }
@@ -9,11 +9,15 @@ All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
 #ifndef YTE_Core_JobSystem_hpp
 #define YTE_Core_JobSystem_hpp
 
-#include <functional>
+#include <algorithm>
+#include <array>
 #include <mutex>
 #include <thread>
+#include <type_traits>
+#include <vector>
 
 #include "YTE/Core/Component.hpp"
+#include "YTE/Core/Threading/IOLane.hpp"
 #include "YTE/Core/Threading/Worker.hpp"
 
 namespace YTE
@@ -26,32 +30,304 @@ namespace YTE
     YTE_Shared JobSystem(Composition *aOwner);
     YTE_Shared ~JobSystem();
     YTE_Shared void Initialize();
+
+    // Reads the Engine config's "JobSystem" object, before Initialize:
+    //   "JobSystem": {
+    //     "Workers": 6,
+    //     "ReservedProcessors": [ 0 ],
+    //     "Affinity": [ 2, 3, 4 ],
+    //     "PinWorkers": true,
+    //     "SpanNumaNodes": false,
+    //     "IOThreads": 2,
+    //     "SingleThreaded": false,
+    //     "Telemetry": { "TrackLatency": true, "ReportInterval": 600 }
+    //   }
+    // Every member is optional. Workers is the number of background workers,
+    // by default one fewer than the processors left to them (the main thread
+    // is the last). Those are the processors we may run on, minus the
+    // reserved ones, and on a machine with more than one NUMA node only the
+    // main thread's node unless SpanNumaNodes is set. Background worker i is
+    // pinned to Affinity[i % size] if given, or with PinWorkers to one of
+    // the processors left to them, the main thread's current one last.
+    // SingleThreaded overrides the rest: no background workers and no I/O
+    // threads, every job runs on the main thread in a repeatable order.
+    // ReportInterval is in frames, 0 disables the periodic report.
+    YTE_Shared void Deserialize(RSValue *aValue) override;
+
+    // Returns once aJobHandle's job has completed. On a worker the waiting
+    // job is suspended and the thread goes on to other work until then, so
+    // waits can nest as deep as they like; just don't hold a lock across one,
+    // the job may resume on another thread. Threads outside the pool (the
+    // I/O lane) can only yield until it's done.
     YTE_Shared void WaitThisThread(JobHandle& aJobHandle);
     YTE_Shared void Update(LogicUpdate *aUpdate);
 
-    // TODO(Evan): Finish FunctionDelegate to allow lambda support
+    // aJob is any callable taking a JobHandle&. It's stored inline in a Job
+    // taken from this thread's worker pool, so this doesn't allocate. If it
+    // returns a value, that's available from JobHandle::GetReturn once the
+    // job completes; jobs returning void skip the Any entirely.
+    //
+    // Unless given one, jobs take the priority of the job queueing them
+    // (Normal outside of a job), and children always take their parent's.
+    template <typename tFunction>
+    JobHandle QueueJobThisThread(tFunction &&aJob)
+    {
+      return QueueJobInternal(MakeJobFunction(std::forward<tFunction>(aJob)), 
+                              nullptr, 
+                              Job::CurrentPriority());
+    }
+
+    template <typename tFunction>
+    JobHandle QueueJobThisThread(tFunction &&aJob, JobPriority aPriority)
+    {
+      return QueueJobInternal(MakeJobFunction(std::forward<tFunction>(aJob)), nullptr, aPriority);
+    }
+
+    template <typename tFunction>
+    JobHandle QueueJobThisThread(tFunction &&aJob, JobHandle& aParentHandle)
+    {
+      return QueueJobInternal(MakeJobFunction(std::forward<tFunction>(aJob)), 
+                              &aParentHandle, 
+                              Job::CurrentPriority());
+    }
+
+    // Queues aJob once every job in aDependencies has completed, without
+    // blocking anyone in the meantime. Capture the dependencies' handles to
+    // read their returns.
+    template <typename tFunction>
+    JobHandle QueueJobAfter(std::vector<JobHandle> const &aDependencies, 
+                            tFunction &&aJob, 
+                            JobPriority aPriority = Job::CurrentPriority())
+    {
+      return QueueJobAfterInternal(MakeJobFunction(std::forward<tFunction>(aJob)), 
+                                   aDependencies, 
+                                   aDependencies.size(),
+                                   aPriority);
+    }
+
+    template <typename tFunction>
+    JobHandle Then(JobHandle const &aPredecessor, 
+                   tFunction &&aJob, 
+                   JobPriority aPriority = Job::CurrentPriority())
+    {
+      return QueueJobAfter({ aPredecessor }, std::forward<tFunction>(aJob), aPriority);
+    }
+
+    // Per worker counters since the last ResetTelemetry (or since the
+    // workers started). Cheap enough to call every frame.
+    YTE_Shared JobSystemTelemetry GetTelemetry();
+    YTE_Shared void ResetTelemetry();
+
+    // Queue to start latency costs two clock reads a job, so unlike the
+    // other counters it's only gathered when asked for.
+    YTE_Shared void SetTrackLatency(bool aTrack);
+
+    bool GetTrackLatency() const
+    {
+      return mTrackLatency;
+    }
+
+    size_t GetTelemetryReportInterval() const
+    {
+      return mReportInterval;
+    }
+
+    void SetTelemetryReportInterval(size_t aFrames)
+    {
+      mReportInterval = aFrames;
+    }
+
+    // Completes once all (or the first) of aJobs have.
+    YTE_Shared JobHandle WhenAll(std::vector<JobHandle> const &aJobs);
+    YTE_Shared JobHandle WhenAny(std::vector<JobHandle> const &aJobs);
+
+    // Queues a job that's ready to run: IO jobs on the I/O lane (or right
+    // away when there are no I/O threads), others on
+    // this thread's worker, or the shared queue when called from outside
+    // the pool. Called by Job once its dependencies have completed.
+    YTE_Shared void ScheduleReady(Job *aJob);
+
+    // Calls aFunction(i) for every i in [aBegin, aEnd). The range is split in
+    // half into child jobs until each piece is at most aGrain long. The
+    // calling thread helps run them and this returns once every index has
+    // been processed. Runs serially when called from a thread outside the
+    // pool or when there are no background workers.
+    template <typename tFunction>
+    void ParallelFor(size_t aBegin, size_t aEnd, size_t aGrain, tFunction &&aFunction)
+    {
+      if (aEnd <= aBegin)
+      {
+        return;
+      }
+
+      aGrain = std::max<size_t>(aGrain, 1);
+
+      if ((aEnd - aBegin) <= aGrain || false == CanRunInParallel())
+      {
+        for (size_t i = aBegin; i < aEnd; ++i)
+        {
+          aFunction(i);
+        }
+
+        return;
+      }
 
-    JobHandle QueueJobThisThread(std::function<Any(JobHandle&)>&& aJob)
+      auto handle = QueueJobThisThread([this, aBegin, aEnd, aGrain, &aFunction](JobHandle &aHandle)
+      {
+        ParallelForRange(aBegin, aEnd, aGrain, aFunction, aHandle);
+      });
+
+      WaitThisThread(handle);
+    }
+
+    // Maps every i in [aBegin, aEnd) with aMap(i) and folds the results with
+    // aReduce(accumulated, mapped), starting from aIdentity. Each grain sized
+    // chunk is folded into its own partial, and the partials are combined in
+    // index order, so the result doesn't depend on scheduling.
+    template <typename tValue, typename tMap, typename tReduce>
+    tValue ParallelReduce(size_t aBegin, 
+                          size_t aEnd, 
+                          size_t aGrain, 
+                          tValue aIdentity, 
+                          tMap &&aMap, 
+                          tReduce &&aReduce)
     {
-      Job* newJob = new Job(std::move(aJob));
-      QueueJobInternal(newJob);
-      return JobHandle(newJob);
+      if (aEnd <= aBegin)
+      {
+        return aIdentity;
+      }
+
+      aGrain = std::max<size_t>(aGrain, 1);
+
+      size_t chunks = (aEnd - aBegin + aGrain - 1) / aGrain;
+      std::vector<tValue> partials(chunks, aIdentity);
+
+      ParallelFor(0, chunks, 1, [&](size_t aChunk)
+      {
+        size_t begin = aBegin + (aChunk * aGrain);
+        size_t end = std::min(begin + aGrain, aEnd);
+
+        tValue partial = aIdentity;
+
+        for (size_t i = begin; i < end; ++i)
+        {
+          partial = aReduce(std::move(partial), aMap(i));
+        }
+
+        partials[aChunk] = std::move(partial);
+      });
+
+      tValue result = std::move(aIdentity);
+
+      for (auto &partial : partials)
+      {
+        result = aReduce(std::move(result), std::move(partial));
+      }
+
+      return result;
     }
 
-    JobHandle QueueJobThisThread(std::function<Any(JobHandle&)>& aJob, JobHandle& aParentHandle)
+    template <typename tFunction>
+    static Job::Function MakeJobFunction(tFunction &&aJob)
     {
-      Job* newJob = new Job(std::move(aJob), aParentHandle);
-      QueueJobInternal(newJob);
-      return JobHandle(newJob);
+      using ReturnType = std::invoke_result_t<std::decay_t<tFunction>&, JobHandle&>;
+
+      if constexpr (std::is_void_v<ReturnType>)
+      {
+        return Job::Function(std::forward<tFunction>(aJob));
+      }
+      else
+      {
+        return Job::Function([job = std::forward<tFunction>(aJob)](JobHandle &aHandle) mutable
+        {
+          aHandle.SetReturn(Any(job(aHandle)));
+        });
+      }
     }
+
   private:
-    void QueueJobInternal(Job* aJob);
+    template <typename tFunction>
+    void ParallelForRange(size_t aBegin, 
+                          size_t aEnd, 
+                          size_t aGrain, 
+                          tFunction &aFunction, 
+                          JobHandle &aParentHandle)
+    {
+      // Hand the upper half off to another job until what's left is small
+      // enough to run here. Each child adds itself to the parent's counters,
+      // so the root job only completes once every piece has run.
+      while (aGrain < (aEnd - aBegin))
+      {
+        size_t middle = aBegin + ((aEnd - aBegin) / 2);
+
+        QueueJobThisThread([this, middle, aEnd, aGrain, &aFunction](JobHandle &aHandle)
+        {
+          ParallelForRange(middle, aEnd, aGrain, aFunction, aHandle);
+        }, aParentHandle);
+        aEnd = middle;
+      }
+
+      for (size_t i = aBegin; i < aEnd; ++i)
+      {
+        aFunction(i);
+      }
+    }
+
+    YTE_Shared Worker* GetWorkerThisThread();
+    YTE_Shared bool CanRunInParallel();
+    YTE_Shared JobHandle QueueJobInternal(Job::Function &&aFunction, 
+                                          JobHandle *aParentHandle,
+                                          JobPriority aPriority);
+    YTE_Shared JobHandle QueueJobAfterInternal(Job::Function &&aFunction,
+                                               std::vector<JobHandle> const &aDependencies,
+                                               size_t aRequired,
+                                               JobPriority aPriority);
+
+    // Where background workers may run, in the order they're pinned.
+    // aRestricted is set if that's narrower than the process is allowed.
+    std::vector<size_t> GetWorkerProcessors(bool &aRestricted);
+
+    // Same as a default thread stack, it's only reserved up front.
+    static constexpr size_t cFiberStackSize = 1024 * 1024;
+
+    JobSystemTelemetry Snapshot();
+    static JobSystemTelemetry Difference(JobSystemTelemetry const &aNow, 
+                                         JobSystemTelemetry const &aBefore);
+    void ProfileFrame();
 
     Worker::WorkerID mForegroundWorker;
     std::unordered_map<Worker::WorkerID, Worker*> mPool;
+
+    // The same workers as mPool, in the order they were created.
+    std::vector<Worker*> mWorkers;
+    WorkerParker mParker;
+    std::array<LockedJobQueue, cWorkerPriorities> mInjected;
+    IOLane mIOLane;
+    FiberPool mFibers;
+    JobSystemTelemetry mReportBaseline;
+    JobSystemTelemetry mFrameBaseline;
+    size_t mReportInterval;
+    size_t mFramesSinceReport;
+    std::atomic<bool> mTrackLatency;
+
+    // Configuration, only read by Initialize. A negative worker count picks
+    // one from the processors available.
+    int mWorkerCount;
+    std::vector<size_t> mReservedProcessors;
+    std::vector<size_t> mAffinity;
+    size_t mIOThreads;
+    bool mPinWorkers;
+    bool mSpanNumaNodes;
+    bool mSingleThreaded;
+
     bool mAsync;
   };
 
+  template <typename tFunction>
+  JobHandle JobHandle::Then(tFunction &&aFunction)
+  {
+    return mJob->GetSystem()->Then(*this, std::forward<tFunction>(aFunction));
+  }
 }
 
 #endif
@@ -0,0 +1,135 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#include <algorithm>
+#include <chrono>
+
+#include "YTE/Core/Threading/JobTelemetry.hpp"
+
+namespace YTE
+{
+  u64 TelemetryNow()
+  {
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+  }
+
+  size_t LatencyHistogram::BucketFor(u64 aNanoseconds)
+  {
+    u64 microseconds = aNanoseconds / 1000;
+    size_t bucket = 0;
+
+    while (0 != microseconds && bucket < (cBuckets - 1))
+    {
+      microseconds >>= 1;
+      ++bucket;
+    }
+
+    return bucket;
+  }
+
+  u64 LatencyHistogram::Count() const
+  {
+    u64 count = 0;
+
+    for (auto bucket : mBuckets)
+    {
+      count += bucket;
+    }
+
+    return count;
+  }
+
+  double LatencyHistogram::Percentile(double aFraction) const
+  {
+    u64 count = Count();
+
+    if (0 == count)
+    {
+      return 0.0;
+    }
+
+    u64 target = static_cast<u64>(aFraction * static_cast<double>(count - 1)) + 1;
+    u64 seen = 0;
+
+    for (size_t i = 0; i < cBuckets; ++i)
+    {
+      seen += mBuckets[i];
+
+      if (target <= seen)
+      {
+        return static_cast<double>(u64(1) << i);
+      }
+    }
+
+    return static_cast<double>(u64(1) << (cBuckets - 1));
+  }
+
+  double WorkerTelemetry::Utilization() const
+  {
+    double total = mBusySeconds + mIdleSeconds;
+    return (0.0 < total) ? (mBusySeconds / total) : 0.0;
+  }
+
+  double WorkerTelemetry::StealRate() const
+  {
+    return mStealsAttempted ? (static_cast<double>(mStealsSucceeded) / mStealsAttempted) : 0.0;
+  }
+
+  WorkerTelemetry JobSystemTelemetry::Total() const
+  {
+    WorkerTelemetry total;
+
+    for (auto &worker : mWorkers)
+    {
+      total.mBusySeconds += worker.mBusySeconds;
+      total.mIdleSeconds += worker.mIdleSeconds;
+      total.mJobsExecuted += worker.mJobsExecuted;
+      total.mStealsAttempted += worker.mStealsAttempted;
+      total.mStealsSucceeded += worker.mStealsSucceeded;
+      total.mMaxQueueDepth = std::max(total.mMaxQueueDepth, worker.mMaxQueueDepth);
+
+      for (size_t i = 0; i < LatencyHistogram::cBuckets; ++i)
+      {
+        total.mLatency.mBuckets[i] += worker.mLatency.mBuckets[i];
+      }
+    }
+
+    return total;
+  }
+
+  static std::string ToString(char const *aName, WorkerTelemetry const &aWorker)
+  {
+    return fmt::format("  {:<8} busy: {:5.1f}% jobs: {:8} steals: {:7}/{:<7} ({:5.1f}%) "
+                       "max depth: {:5} latency p50/p99: {}/{} us\n",
+                       aName,
+                       100.0 * aWorker.Utilization(),
+                       aWorker.mJobsExecuted,
+                       aWorker.mStealsSucceeded,
+                       aWorker.mStealsAttempted,
+                       100.0 * aWorker.StealRate(),
+                       aWorker.mMaxQueueDepth,
+                       aWorker.mLatency.Percentile(0.5),
+                       aWorker.mLatency.Percentile(0.99));
+  }
+
+  std::string ToString(JobSystemTelemetry const &aTelemetry)
+  {
+    std::string report = "JobSystem telemetry:\n";
+
+    for (size_t i = 0; i < aTelemetry.mWorkers.size(); ++i)
+    {
+      bool main = (i + 1) == aTelemetry.mWorkers.size();
+      auto name = main ? std::string("main") : fmt::format("{}", i);
+
+      report += ToString(name.c_str(), aTelemetry.mWorkers[i]);
+    }
+
+    report += ToString("total", aTelemetry.Total());
+
+    return report;
+  }
+}
@@ -0,0 +1,87 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "YTE/Core/Utilities.hpp"
+
+namespace YTE
+{
+  // Nanoseconds on a steady clock, only meaningful relative to each other.
+  u64 TelemetryNow();
+
+  // How long jobs sat in a queue before a worker started them. Bucket 0 is
+  // under a microsecond, bucket i is [2^(i-1), 2^i) microseconds, and the last
+  // bucket takes everything longer (about 4 seconds and up).
+  struct LatencyHistogram
+  {
+    static constexpr size_t cBuckets = 24;
+
+    static size_t BucketFor(u64 aNanoseconds);
+
+    u64 Count() const;
+
+    // The upper bound, in microseconds, of the bucket holding the job at
+    // aFraction (0 to 1) of the way through the sorted latencies.
+    double Percentile(double aFraction) const;
+
+    std::array<u64, cBuckets> mBuckets{};
+  };
+
+  struct WorkerTelemetry
+  {
+    double Utilization() const;
+
+    // Of the steals attempted, how many got a job.
+    double StealRate() const;
+
+    double mBusySeconds = 0.0;
+    double mIdleSeconds = 0.0;
+    u64 mJobsExecuted = 0;
+    u64 mStealsAttempted = 0;
+    u64 mStealsSucceeded = 0;
+    size_t mMaxQueueDepth = 0;
+    LatencyHistogram mLatency;
+  };
+
+  struct JobSystemTelemetry
+  {
+    // Every worker summed, the max queue depth is the deepest of them.
+    WorkerTelemetry Total() const;
+
+    // Background workers in the order they were created, the main thread's
+    // worker last.
+    std::vector<WorkerTelemetry> mWorkers;
+  };
+
+  std::string ToString(JobSystemTelemetry const &aTelemetry);
+
+  // What a Worker counts as it goes. Only the worker's own thread writes
+  // them, so they're updated without read-modify-writes, anyone can read.
+  struct WorkerCounters
+  {
+    static void Add(std::atomic<u64> &aCounter, u64 aAmount)
+    {
+      aCounter.store(aCounter.load(std::memory_order_relaxed) + aAmount,
+                     std::memory_order_relaxed);
+    }
+
+    std::atomic<u64> mIdleNanoseconds{ 0 };
+    std::atomic<u64> mJobsExecuted{ 0 };
+    std::atomic<u64> mStealsAttempted{ 0 };
+    std::atomic<u64> mStealsSucceeded{ 0 };
+
+    // Reset by the JobSystem, the only counter not read as a difference.
+    std::atomic<u64> mMaxQueueDepth{ 0 };
+
+    std::array<std::atomic<u64>, LatencyHistogram::cBuckets> mLatency{};
+  };
+}
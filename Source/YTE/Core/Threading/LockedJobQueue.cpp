@@ -0,0 +1,62 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#include "YTE/Core/Threading/LockedJobQueue.hpp"
+
+namespace YTE
+{
+  LockedJobQueue::LockedJobQueue()
+    : mSize(0)
+  {
+  }
+
+  LockedJobQueue::~LockedJobQueue()
+  {
+    Flush();
+  }
+
+  void LockedJobQueue::Push(Job *aJob)
+  {
+    std::lock_guard<std::mutex> lock(mLock);
+    mJobs.push_back(aJob);
+    mSize.store(mJobs.size(), std::memory_order_seq_cst);
+  }
+
+  Job* LockedJobQueue::Pop()
+  {
+    if (0 == mSize.load(std::memory_order_relaxed))
+    {
+      return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(mLock);
+
+    if (mJobs.empty())
+    {
+      return nullptr;
+    }
+
+    Job *job = mJobs.front();
+    mJobs.pop_front();
+    mSize.store(mJobs.size(), std::memory_order_relaxed);
+
+    return job;
+  }
+
+  void LockedJobQueue::Flush()
+  {
+    while (Job *job = Pop())
+    {
+      job->Abandon();
+      job->RemoveReference();
+    }
+  }
+
+  size_t LockedJobQueue::Size() const
+  {
+    return mSize.load(std::memory_order_relaxed);
+  }
+}
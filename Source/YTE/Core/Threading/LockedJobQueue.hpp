@@ -0,0 +1,40 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+
+#include "YTE/Core/Threading/Job.hpp"
+
+namespace YTE
+{
+  // First in first out queue any thread may push to or pop from. Used where
+  // the producer isn't a worker and so can't own a JobQueue: the I/O lane,
+  // and jobs queued from threads outside the worker pool.
+  class LockedJobQueue
+  {
+  public:
+    YTE_Shared LockedJobQueue();
+    YTE_Shared ~LockedJobQueue();
+
+    YTE_Shared void Push(Job *aJob);
+    YTE_Shared Job* Pop();
+
+    // Abandons and releases every job left in the queue.
+    void Flush();
+
+    // Lock free, so it may be stale by the time it's used.
+    YTE_Shared size_t Size() const;
+
+  private:
+    mutable std::mutex mLock;
+    std::deque<Job*> mJobs;
+    std::atomic<size_t> mSize;
+  };
+}
@@ -4,21 +4,47 @@
 All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
 */
 /******************************************************************************/
+#include <algorithm>
+
+#include "YTE/Core/Threading/JobSystem.hpp"
 #include "YTE/Core/Threading/Worker.hpp"
 
+#include "YTE/Platform/Processors.hpp"
+
 namespace YTE
 {
-  Worker::Worker()
-    : mState(WorkerState::Started), mStopped(false)
+  static thread_local Worker *tCurrentWorker = nullptr;
+
+  Worker::Worker(WorkerParker *aParker, LockedJobQueue *aInjected, FiberPool *aFibers)
+    : mStopped(false)
+    , mParker(aParker)
+    , mFibers(aFibers)
+    , mThreadFiber()
+    , mCounters()
+    , mAffinity()
+    , mWaitNanoseconds(0)
+    , mPoolDepth(0)
+    , mPoolEnteredAt(0)
+    , mState(WorkerState::Started)
+    , mJobPool(new JobPool())
+    , mInjected(aInjected)
+    , mSpinLimit(cMinSpin)
+    , mCurrentFiber(nullptr)
+    , mAfterSwitch()
+    , mThreadFiberState(ThreadFiberState::Running)
+    , mTrackLatency(false)
   {
   }
 
   Worker::~Worker()
   {
-    for (auto& job : mCompletedJobs) {
-      job->Abandon();
-      delete job;
+    // Jobs still in the queue or held by handles keep the pool alive.
+    for (auto &queue : mQueues)
+    {
+      queue.Flush();
     }
+
+    mJobPool->ReleaseOwner();
   }
 
   void Worker::Pause()
@@ -29,38 +55,140 @@ namespace YTE
   void Worker::Unpause()
   {
     SetState(WorkerState::Started);
+    mParker->UnparkAll();
   }
 
   void Worker::Queue(Job* aJob)
   {
-    mQueue.Push(aJob);
+    DebugObjection(cWorkerPriorities <= static_cast<size_t>(aJob->GetPriority()),
+                   "IO jobs belong on the IOLane, not a Worker.");
+
+    if (mTrackLatency.load(std::memory_order_relaxed))
+    {
+      aJob->SetQueuedAt(TelemetryNow());
+    }
+
+    auto &queue = mQueues[static_cast<size_t>(aJob->GetPriority())];
+    queue.Push(aJob);
+
+    u64 depth = queue.Size();
+    if (mCounters.mMaxQueueDepth.load(std::memory_order_relaxed) < depth)
+    {
+      mCounters.mMaxQueueDepth.store(depth, std::memory_order_relaxed);
+    }
+
+    mParker->UnparkOne();
   }
 
   void Worker::Wait(JobHandle& aJob)
   {
-    while (!aJob.HasCompleted())
+    if (aJob.HasCompleted())
     {
-      ExecuteNext();
+      return;
     }
+
+    // Anything run on our thread's own fiber is stuck on this thread if it
+    // waits, so there we'd rather suspend and leave the job to a pooled
+    // fiber. It also means we're still ours once it's done.
+    if (mThreadFiber && (mCurrentFiber == mThreadFiber.get()))
+    {
+      EnterPool();
+      Suspend(aJob);
+      LeavePool();
+      return;
+    }
+
+    // Running it may have moved us to another thread, start over on
+    // whichever worker we're on now.
+    if (RunIfNext(aJob.GetJob()))
+    {
+      Current()->Wait(aJob);
+      return;
+    }
+
+    Suspend(aJob);
   }
 
-  void Worker::Clean()
+  void Worker::Suspend(JobHandle &aJob)
   {
-    std::vector<Job*> mNotDeletedJobs;
-    for (auto& job : mCompletedJobs)
+    Fiber *next = mCurrentFiber ? mFibers->Acquire() : nullptr;
+
+    // Without a fiber to hand the thread to we can only help out until it's
+    // done. Any job we run could suspend us, so don't hold on to this.
+    if (nullptr == next)
     {
-      if (job->IsDeletable())
+      while (!aJob.HasCompleted())
       {
-        delete job;
-        job = nullptr;
+        if (false == Current()->ExecuteNext())
+        {
+          YieldThread();
+        }
       }
-      else
+
+      return;
+    }
+
+    // The thread goes back to the worker loop, which runs jobs at whatever
+    // priority they have.
+    JobPriority priority = Job::CurrentPriority();
+    Job::SetCurrentPriority(JobPriority::Normal);
+
+    SwitchAction action;
+    action.mType = SwitchAction::Type::Wait;
+    action.mJob = aJob.GetJob();
+    action.mPriority = priority;
+
+    SwitchTo(next, action);
+
+    // aJob has completed, but we're quite likely on another worker's thread
+    // now, so this isn't our worker anymore.
+    Job::SetCurrentPriority(priority);
+  }
+
+  bool Worker::RunIfNext(Job *aJob)
+  {
+    if (JobPriority::IO == aJob->GetPriority())
+    {
+      return false;
+    }
+
+    // Usually we're waiting on the job we just queued, so unless someone's
+    // stolen it, it's on the bottom of our queue. Running it here is much
+    // cheaper than suspending.
+    JobQueue &queue = mQueues[static_cast<size_t>(aJob->GetPriority())];
+
+    if (0 == queue.Size())
+    {
+      return false;
+    }
+
+    Job *job = queue.Pop();
+
+    if (job != aJob)
+    {
+      if (job)
       {
-        mNotDeletedJobs.push_back(job);
+        queue.Push(job);
       }
+
+      return false;
     }
 
-    mCompletedJobs = mNotDeletedJobs;
+    StartJob(job);
+    job->Invoke();
+    return true;
+  }
+
+  void Worker::StartJob(Job *aJob)
+  {
+    WorkerCounters::Add(mCounters.mJobsExecuted, 1);
+
+    if (u64 queuedAt = aJob->GetQueuedAt())
+    {
+      u64 now = TelemetryNow();
+      size_t bucket = LatencyHistogram::BucketFor((queuedAt < now) ? (now - queuedAt) : 0);
+      WorkerCounters::Add(mCounters.mLatency[bucket], 1);
+    }
   }
 
   void Worker::AddCoworker(Worker * aWorker)
@@ -68,11 +196,233 @@ namespace YTE
     mCoworkers.push_back(aWorker);
   }
 
+  JobPool* Worker::GetJobPool()
+  {
+    return mJobPool;
+  }
+
+  WorkerTelemetry Worker::GetTelemetry() const
+  {
+    WorkerTelemetry telemetry;
+
+    u64 idle = mCounters.mIdleNanoseconds.load(std::memory_order_relaxed);
+    u64 inPool = std::max(NanosecondsInPool(), idle);
+
+    telemetry.mBusySeconds = static_cast<double>(inPool - idle) / 1e9;
+    telemetry.mIdleSeconds = static_cast<double>(idle) / 1e9;
+    telemetry.mJobsExecuted = mCounters.mJobsExecuted.load(std::memory_order_relaxed);
+    telemetry.mStealsAttempted = mCounters.mStealsAttempted.load(std::memory_order_relaxed);
+    telemetry.mStealsSucceeded = mCounters.mStealsSucceeded.load(std::memory_order_relaxed);
+    telemetry.mMaxQueueDepth = static_cast<size_t>(mCounters.mMaxQueueDepth.load(std::memory_order_relaxed));
+
+    for (size_t i = 0; i < LatencyHistogram::cBuckets; ++i)
+    {
+      telemetry.mLatency.mBuckets[i] = mCounters.mLatency[i].load(std::memory_order_relaxed);
+    }
+
+    return telemetry;
+  }
+
+  void Worker::ResetMaxQueueDepth()
+  {
+    // Racing the owner is fine, anything it stores is a depth it really saw.
+    mCounters.mMaxQueueDepth.store(0, std::memory_order_relaxed);
+  }
+
+  void Worker::EnterPool()
+  {
+    if (0 == mPoolDepth++)
+    {
+      mPoolEnteredAt = TelemetryNow();
+    }
+  }
+
+  void Worker::LeavePool()
+  {
+    if (0 == --mPoolDepth)
+    {
+      WorkerCounters::Add(mWaitNanoseconds, TelemetryNow() - mPoolEnteredAt);
+    }
+  }
+
+  void Worker::SetTrackLatency(bool aTrack)
+  {
+    mTrackLatency.store(aTrack, std::memory_order_relaxed);
+  }
+
+  void Worker::SetAffinity(std::vector<size_t> aProcessors)
+  {
+    mAffinity = std::move(aProcessors);
+  }
+
+  Worker* Worker::Current()
+  {
+    return tCurrentWorker;
+  }
+
+  void Worker::FiberMain(void *aData)
+  {
+    UnusedArguments(aData);
+
+    Current()->FinishSwitch();
+    Loop();
+  }
+
+  void Worker::StartThisThread()
+  {
+    tCurrentWorker = this;
+
+    auto fiber = std::make_unique<Fiber>();
+
+    if (fiber->IsValid())
+    {
+      mThreadFiber = std::move(fiber);
+      mCurrentFiber = mThreadFiber.get();
+    }
+  }
+
+  void Worker::StopThisThread()
+  {
+    mCurrentFiber = nullptr;
+    mThreadFiber.reset();
+    tCurrentWorker = nullptr;
+  }
+
+  void Worker::SwitchTo(Fiber *aFiber, SwitchAction aAction)
+  {
+    Worker *worker = Current();
+
+    aAction.mFiber = worker->mCurrentFiber;
+    worker->mAfterSwitch = aAction;
+    worker->mCurrentFiber = aFiber;
+
+    aFiber->SwitchTo();
+
+    // Someone switched back to us, possibly from another thread.
+    Current()->FinishSwitch();
+  }
+
+  void Worker::FinishSwitch()
+  {
+    SwitchAction action = mAfterSwitch;
+    mAfterSwitch = SwitchAction{};
+
+    switch (action.mType)
+    {
+      case SwitchAction::Type::None:
+      {
+        break;
+      }
+      case SwitchAction::Type::Release:
+      {
+        mFibers->Release(action.mFiber);
+        break;
+      }
+      case SwitchAction::Type::Wait:
+      {
+        // Our own thread's fiber can't move to another thread, so rather
+        // than being made ready for anyone, we're told when it can resume.
+        Worker *owner = nullptr;
+
+        if (action.mFiber == mThreadFiber.get())
+        {
+          owner = this;
+          mThreadFiberState = ThreadFiberState::Waiting;
+        }
+
+        Fiber *fiber = action.mFiber;
+        FiberPool *fibers = mFibers;
+        WorkerParker *parker = mParker;
+
+        JobHandle waitingOn(action.mJob);
+        waitingOn.GetJob()->GetSystem()->Then(waitingOn, [owner, fiber, fibers, parker](JobHandle&)
+        {
+          if (owner)
+          {
+            owner->mThreadFiberState = ThreadFiberState::Ready;
+            parker->UnparkAll();
+          }
+          else
+          {
+            fibers->MakeReady(fiber);
+            parker->UnparkOne();
+          }
+        }, action.mPriority);
+        break;
+      }
+    }
+  }
+
+  bool Worker::ResumeReady()
+  {
+    Fiber *fiber = nullptr;
+
+    ThreadFiberState ready = ThreadFiberState::Ready;
+
+    if (mThreadFiberState.compare_exchange_strong(ready, ThreadFiberState::Running))
+    {
+      fiber = mThreadFiber.get();
+    }
+    else
+    {
+      fiber = mFibers->PopReady();
+    }
+
+    if (nullptr == fiber)
+    {
+      return false;
+    }
+
+    // We're at the top of the loop, so there's nothing on our stack and
+    // anyone can have this fiber.
+    SwitchAction action;
+    action.mType = SwitchAction::Type::Release;
+    SwitchTo(fiber, action);
+
+    return true;
+  }
+
+  void Worker::Loop()
+  {
+    while (true)
+    {
+      // Jobs we run may suspend us and resume us elsewhere, so look the
+      // worker up again every time around.
+      Worker *worker = Current();
+
+      // Only background workers stop, and their thread's fiber is sitting in
+      // BackgroundWorker::Init waiting to be given the thread back.
+      if (worker->mState == WorkerState::Stopped &&
+          ThreadFiberState::Running == worker->mThreadFiberState)
+      {
+        SwitchAction action;
+        action.mType = SwitchAction::Type::Release;
+        SwitchTo(worker->mThreadFiber.get(), action);
+        continue;
+      }
+
+      // Fibers that were waiting get to finish what they started before
+      // anything new is picked up.
+      if (worker->mState != WorkerState::Paused && worker->ResumeReady())
+      {
+        continue;
+      }
+
+      if (false == worker->ExecuteNext())
+      {
+        worker->Idle();
+      }
+    }
+  }
+
   void Worker::Run()
   {
     while (mState != WorkerState::Stopped)
     {
-      ExecuteNext();
+      if (false == ExecuteNext())
+      {
+        Idle();
+      }
     }
 
     mStopped = true;
@@ -80,30 +430,73 @@ namespace YTE
 
   void Worker::YieldThread()
   {
-    // TODO (Evan): Time tasks to figure out sleep length
-    std::this_thread::sleep_for(std::chrono::microseconds(500));
+    std::this_thread::yield();
   }
 
-  void Worker::ExecuteNext()
+  bool Worker::ExecuteNext()
   {
     if (mState == WorkerState::Paused)
     {
-      YieldThread();
-      return;
+      return false;
     }
 
     auto job = GetJob();
-    if (job)
+    if (nullptr == job)
     {
-      SetState(WorkerState::Running);
-      job->Invoke();
-      mCompletedJobs.push_back(job);
+      SetState(WorkerState::Idle);
+      return false;
     }
-    else
+
+    SetState(WorkerState::Running);
+    StartJob(job);
+    job->Invoke();
+
+    // The job may have waited and been resumed on another thread.
+    Current()->SetState(WorkerState::Idle);
+    return true;
+  }
+
+  void Worker::Idle()
+  {
+    u64 begin = TelemetryNow();
+    SpinOrPark();
+    WorkerCounters::Add(mCounters.mIdleNanoseconds, TelemetryNow() - begin);
+  }
+
+  void Worker::SpinOrPark()
+  {
+    // Spin for a while first, a job is often queued shortly after we run out.
+    // The spin length adapts: it grows when spinning pays off and shrinks
+    // when we end up parking anyway. We only look here, running a job could
+    // move us to another thread, so that's left to our caller.
+    for (int i = 0; i < mSpinLimit; ++i)
     {
+      if (mState == WorkerState::Stopped)
+      {
+        return;
+      }
+
+      if (mState != WorkerState::Paused && HasWork())
+      {
+        mSpinLimit = std::min(mSpinLimit * 2, cMaxSpin);
+        return;
+      }
+
       YieldThread();
     }
-    SetState(WorkerState::Idle);
+
+    mSpinLimit = std::max(mSpinLimit / 2, cMinSpin);
+
+    mParker->PrepareToPark();
+
+    if (mState == WorkerState::Stopped ||
+        (mState != WorkerState::Paused && HasWork()))
+    {
+      mParker->CancelPark();
+      return;
+    }
+
+    mParker->Park();
   }
 
   void Worker::SetState(WorkerState aState)
@@ -113,32 +506,90 @@ namespace YTE
     }
   }
 
-  Job* Worker::StealFrom()
+  Job* Worker::StealFrom(size_t aPriority)
   {
-    return mQueue.Steal();
+    return mQueues[aPriority].Steal();
   }
 
-  Job* Worker::GetJob()
+  bool Worker::HasWork() const
   {
-    Job* job = mQueue.Pop();
-    if (job)
+    if (ThreadFiberState::Ready == mThreadFiberState || mFibers->ReadyCount())
     {
-      return job;
+      return true;
     }
-    else if (!mCoworkers.empty())
+
+    for (size_t priority = 0; priority < cWorkerPriorities; ++priority)
+    {
+      if (mQueues[priority].Size() || mInjected[priority].Size())
+      {
+        return true;
+      }
+
+      for (auto &coworker : mCoworkers)
+      {
+        if (coworker->mQueues[priority].Size())
+        {
+          return true;
+        }
+      }
+    }
+
+    return false;
+  }
+
+  Job* Worker::GetJob()
+  {
+    // TODO(Evan): make choosing the coworker to rob smarter
+    size_t first = mCoworkers.empty() ? 0 : (std::rand() % mCoworkers.size());
+
+    // Everything at a priority, ours, injected and our coworkers', is
+    // tried before moving on to the next one down. Most queues are empty
+    // most of the time, so check their size before paying for the fences in
+    // Pop and Steal.
+    for (size_t priority = 0; priority < cWorkerPriorities; ++priority)
     {
-      // TODO(Evan): make choosing the coworker to rob smarter
-      int index = std::rand() % mCoworkers.size();
-      return mCoworkers[index]->StealFrom();
+      if (mQueues[priority].Size())
+      {
+        if (Job *job = mQueues[priority].Pop())
+        {
+          return job;
+        }
+      }
+
+      if (Job *job = mInjected[priority].Pop())
+      {
+        return job;
+      }
+
+      for (size_t i = 0; i < mCoworkers.size(); ++i)
+      {
+        auto coworker = mCoworkers[(first + i) % mCoworkers.size()];
+
+        if (0 == coworker->mQueues[priority].Size())
+        {
+          continue;
+        }
+
+        WorkerCounters::Add(mCounters.mStealsAttempted, 1);
+
+        if (Job *job = coworker->StealFrom(priority))
+        {
+          WorkerCounters::Add(mCounters.mStealsSucceeded, 1);
+          return job;
+        }
+      }
     }
 
-    // TODO(Evan): Is this what it should do?
     return nullptr;
   }
 
 
-  BackgroundWorker::BackgroundWorker()
-    : mThread()
+  BackgroundWorker::BackgroundWorker(WorkerParker *aParker, 
+                                     LockedJobQueue *aInjected, 
+                                     FiberPool *aFibers)
+    : Worker(aParker, aInjected, aFibers)
+    , mThread()
+    , mCreatedAt(TelemetryNow())
   {
   }
 
@@ -149,7 +600,31 @@ namespace YTE
 
   void BackgroundWorker::Init()
   {
-    mThread = std::thread([this]() { Run(); });
+    mThread = std::thread([this]()
+    {
+      if (false == mAffinity.empty())
+      {
+        SetThisThreadAffinity(mAffinity);
+      }
+
+      StartThisThread();
+
+      // The loop runs on a pooled fiber, so waiting jobs never end up on the
+      // thread's own stack. We're switched back to once we've stopped.
+      Fiber *loop = mThreadFiber ? mFibers->Acquire() : nullptr;
+
+      if (loop)
+      {
+        SwitchTo(loop, SwitchAction{});
+        mStopped = true;
+      }
+      else
+      {
+        Run();
+      }
+
+      StopThisThread();
+    });
   }
 
   void BackgroundWorker::Join()
@@ -157,10 +632,14 @@ namespace YTE
     while (!mStopped)
     {
       SetState(WorkerState::Stopped);
+      mParker->UnparkAll();
       YieldThread();
     }
 
-    mThread.join();
+    if (mThread.joinable())
+    {
+      mThread.join();
+    }
   }
 
   Worker::WorkerID BackgroundWorker::GetID()
@@ -168,19 +647,33 @@ namespace YTE
     return mThread.get_id();
   }
 
+  u64 BackgroundWorker::NanosecondsInPool() const
+  {
+    return TelemetryNow() - mCreatedAt;
+  }
 
-  ForegroundWorker::ForegroundWorker(bool aAsync)
-    : mAsync(aAsync), mID(std::this_thread::get_id())
+
+  ForegroundWorker::ForegroundWorker(WorkerParker *aParker, 
+                                     LockedJobQueue *aInjected, 
+                                     FiberPool *aFibers, 
+                                     bool aAsync)
+    : Worker(aParker, aInjected, aFibers), mID(std::this_thread::get_id()), mAsync(aAsync)
   {
   }
 
   void ForegroundWorker::Init()
   {
+    StartThisThread();
   }
 
   void ForegroundWorker::Join()
   {
     SetState(WorkerState::Stopped);
+
+    if (Current() == this)
+    {
+      StopThisThread();
+    }
   }
 
   Worker::WorkerID ForegroundWorker::GetID()
@@ -190,6 +683,27 @@ namespace YTE
 
   void ForegroundWorker::RunForeground()
   {
-    ExecuteNext();
+    // The job may wait, but on our own fiber, so we're still us after.
+    EnterPool();
+
+    // With no background workers nobody else will ever get to what's queued
+    // (say from the I/O lane, or a job nobody waits on), so drain it all.
+    if (mAsync)
+    {
+      ExecuteNext();
+    }
+    else
+    {
+      while (ExecuteNext())
+      {
+      }
+    }
+
+    LeavePool();
+  }
+
+  u64 ForegroundWorker::NanosecondsInPool() const
+  {
+    return mWaitNanoseconds.load(std::memory_order_relaxed);
   }
 }
@@ -5,14 +5,33 @@ All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
 */
 /******************************************************************************/
 #pragma once
+#include <array>
+#include <memory>
 #include <thread>
+#include <vector>
 
+#include "YTE/Core/Threading/FiberPool.hpp"
 #include "YTE/Core/Threading/Job.hpp"
 #include "YTE/Core/Threading/JobHandle.hpp"
+#include "YTE/Core/Threading/JobPool.hpp"
 #include "YTE/Core/Threading/JobQueue.hpp"
+#include "YTE/Core/Threading/JobTelemetry.hpp"
+#include "YTE/Core/Threading/LockedJobQueue.hpp"
+#include "YTE/Core/Threading/WorkerParker.hpp"
 
 namespace YTE
 {
+  // Workers run on fibers taken from a FiberPool. A job that waits on
+  // another job that hasn't completed suspends the fiber it's running on and
+  // hands the thread to a free fiber, which carries on with the worker loop.
+  // Once the job it's waiting on completes, the waiting fiber is made ready
+  // and resumed by whichever worker gets to it first. The one exception is a
+  // thread's own fiber (the main thread waiting, usually), which is only
+  // ever resumed by its own thread.
+  //
+  // Since a job may finish on a different thread than it started on, it
+  // mustn't hold a lock (or anything else tied to the thread) while it
+  // waits.
   class Worker
   {
   public:
@@ -25,54 +44,157 @@ namespace YTE
       Stopped
     };
     typedef std::thread::id WorkerID;
-    Worker();
-    ~Worker();
+
+    // aInjected is shared by every worker, one queue per worker priority,
+    // for jobs queued from threads outside the pool.
+    Worker(WorkerParker *aParker, LockedJobQueue *aInjected, FiberPool *aFibers);
+    virtual ~Worker();
     virtual void Init() = 0;
     virtual void Join() = 0;
     void Pause();
     void Unpause();
     void Queue(Job* aJob);
     void Wait(JobHandle& aJob);
-    void Clean();
     void AddCoworker(Worker* aWorker);
+    JobPool* GetJobPool();
     virtual WorkerID GetID() = 0;
+
+    // Counters since the worker was created, safe to call from any thread.
+    WorkerTelemetry GetTelemetry() const;
+    void ResetMaxQueueDepth();
+
+    // Stamps jobs as they're queued so the time until they start can be
+    // measured. Costs two clock reads a job, so it's off by default.
+    void SetTrackLatency(bool aTrack);
+
+    // Processors the worker's thread may run on, empty for any. Only takes
+    // effect if set before Init, and only background workers have a thread
+    // of their own to restrict.
+    void SetAffinity(std::vector<size_t> aProcessors);
+
+    // The worker whose thread we're on, if any.
+    static Worker* Current();
+
+    // What every fiber in the FiberPool runs.
+    static void FiberMain(void *aData);
+
   protected:
+    // What a thread does with the fiber it just switched away from, done by
+    // the fiber switched to. Waiting fibers can't be handed to anyone else
+    // until they're no longer running.
+    struct SwitchAction
+    {
+      enum class Type
+      {
+        None,
+        Release,
+        Wait
+      };
+
+      Type mType = Type::None;
+      Fiber *mFiber = nullptr;
+      Job *mJob = nullptr;
+      JobPriority mPriority = JobPriority::Normal;
+    };
+
+    enum class ThreadFiberState
+    {
+      Running,
+      Waiting,
+      Ready
+    };
+
+    // Makes this the worker for the calling thread and turns the thread into
+    // a fiber.
+    void StartThisThread();
+    void StopThisThread();
+
+    // How long this worker's thread has been given to the pool, busy or not.
+    virtual u64 NanosecondsInPool() const = 0;
+
     void Run();
     void YieldThread();
-    void ExecuteNext();
+    bool ExecuteNext();
+    void Idle();
+    void SpinOrPark();
     void SetState(WorkerState aState);
 
-    bool mStopped;
+    static void SwitchTo(Fiber *aFiber, SwitchAction aAction);
+    static void Loop();
+
+    std::atomic<bool> mStopped;
+    WorkerParker *mParker;
+    FiberPool *mFibers;
+    std::unique_ptr<Fiber> mThreadFiber;
+    WorkerCounters mCounters;
+    std::vector<size_t> mAffinity;
+
+    // Time the thread's own fiber spent waiting on or running jobs, only
+    // used when the thread isn't the pool's to begin with. Enter and leave
+    // nest, the outermost pair is what's counted.
+    void EnterPool();
+    void LeavePool();
+
+    std::atomic<u64> mWaitNanoseconds;
+    int mPoolDepth;
+    u64 mPoolEnteredAt;
   private:
-    Job* StealFrom();
+    Job* StealFrom(size_t aPriority);
     Job* GetJob();
+    bool HasWork() const;
+    bool RunIfNext(Job *aJob);
+    void Suspend(JobHandle &aJob);
+    void StartJob(Job *aJob);
+    void FinishSwitch();
+    bool ResumeReady();
+
+    // Bounds for the adaptive spin before parking, in calls to GetJob.
+    static constexpr int cMinSpin = 16;
+    static constexpr int cMaxSpin = 1024;
 
     std::atomic<WorkerState> mState;
-    JobQueue mQueue;
-    std::vector<Job*> mCompletedJobs;
+    JobPool *mJobPool;
+    std::array<JobQueue, cWorkerPriorities> mQueues;
+    LockedJobQueue *mInjected;
+    int mSpinLimit;
     std::vector<Worker*> mCoworkers;
+
+    // Only touched by the thread this worker runs on.
+    Fiber *mCurrentFiber;
+    SwitchAction mAfterSwitch;
+
+    std::atomic<ThreadFiberState> mThreadFiberState;
+    std::atomic<bool> mTrackLatency;
   };
 
   class BackgroundWorker : public Worker
   {
   public:
-    BackgroundWorker();
+    BackgroundWorker(WorkerParker *aParker, LockedJobQueue *aInjected, FiberPool *aFibers);
     ~BackgroundWorker();
     virtual void Init() override;
     virtual void Join() override;
     virtual WorkerID GetID() override;
+  protected:
+    virtual u64 NanosecondsInPool() const override;
   private:
     std::thread mThread;
+    u64 mCreatedAt;
   };
 
   class ForegroundWorker : public Worker
   {
   public:
-    ForegroundWorker(bool aAsync);
+    ForegroundWorker(WorkerParker *aParker, 
+                     LockedJobQueue *aInjected, 
+                     FiberPool *aFibers, 
+                     bool aAsync);
     virtual void Init() override;
     virtual void Join() override;
     virtual WorkerID GetID() override;
     void RunForeground();
+  protected:
+    virtual u64 NanosecondsInPool() const override;
   private:
     WorkerID mID;
     bool mAsync;
@@ -0,0 +1,70 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#include "YTE/Core/Threading/WorkerParker.hpp"
+
+namespace YTE
+{
+  WorkerParker::WorkerParker()
+    : mSleepers(0)
+    , mSignals(0)
+  {
+  }
+
+  void WorkerParker::PrepareToPark()
+  {
+    mSleepers.fetch_add(1, std::memory_order_seq_cst);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+  }
+
+  void WorkerParker::CancelPark()
+  {
+    mSleepers.fetch_sub(1, std::memory_order_seq_cst);
+  }
+
+  void WorkerParker::Park()
+  {
+    std::unique_lock<std::mutex> lock(mLock);
+    mCondition.wait(lock, [this]() { return 0 < mSignals; });
+    --mSignals;
+    mSleepers.fetch_sub(1, std::memory_order_seq_cst);
+  }
+
+  void WorkerParker::UnparkOne()
+  {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (0 == mSleepers.load(std::memory_order_relaxed))
+    {
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mLock);
+
+      // Signals left over from cancelled parks are capped so they can only
+      // cause a single spurious wake up each.
+      if (mSignals < mSleepers.load(std::memory_order_relaxed))
+      {
+        ++mSignals;
+      }
+    }
+
+    mCondition.notify_one();
+  }
+
+  void WorkerParker::UnparkAll()
+  {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    {
+      std::lock_guard<std::mutex> lock(mLock);
+      mSignals = mSleepers.load(std::memory_order_relaxed);
+    }
+
+    mCondition.notify_all();
+  }
+}
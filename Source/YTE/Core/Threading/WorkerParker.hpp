@@ -0,0 +1,39 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+namespace YTE
+{
+  // Lets idle workers block instead of polling. A worker that wants to sleep
+  // calls PrepareToPark, re-checks for work, and then either calls CancelPark
+  // or Park. Anyone queueing work calls UnparkOne afterwards. Because the
+  // sleeper count is published before the re-check, and producers check it
+  // after publishing their job, a wake up can't be lost in between.
+  class WorkerParker
+  {
+  public:
+    WorkerParker();
+
+    void PrepareToPark();
+    void CancelPark();
+    void Park();
+
+    // Cheap when nobody is parked: a fence and a single load.
+    void UnparkOne();
+    void UnparkAll();
+
+  private:
+    std::atomic<int> mSleepers;
+    int mSignals;
+    std::mutex mLock;
+    std::condition_variable mCondition;
+  };
+}
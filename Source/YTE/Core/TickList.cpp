@@ -0,0 +1,182 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#include <utility>
+
+#include "YTE/Core/TickList.hpp"
+
+namespace YTE
+{
+  TickRegistration::TickRegistration(TickList *aList, void *aObject, Runner aRunner)
+    : mList(aList)
+    , mObject(aObject)
+    , mRunner(aRunner)
+    , mGroup(0)
+    , mIndex(0)
+    , mPending(false)
+  {
+    mList->Add(this);
+  }
+
+  TickRegistration::~TickRegistration()
+  {
+    if (mList)
+    {
+      mList->Remove(this);
+    }
+  }
+
+  TickList::TickList()
+    : mCount(0)
+    , mIterating(false)
+    , mRemoved(false)
+  {
+  }
+
+  TickList::~TickList()
+  {
+    for (auto &group : mGroups)
+    {
+      for (auto registration : group.mRegistrations)
+      {
+        if (registration)
+        {
+          registration->mList = nullptr;
+        }
+      }
+    }
+
+    for (auto registration : mPending)
+    {
+      if (registration)
+      {
+        registration->mList = nullptr;
+      }
+    }
+  }
+
+  void TickList::Add(TickRegistration *aRegistration)
+  {
+    ++mCount;
+
+    // Growing the arrays would pull them out from under Run.
+    if (mIterating)
+    {
+      aRegistration->mPending = true;
+      aRegistration->mIndex = mPending.size();
+      mPending.push_back(aRegistration);
+      return;
+    }
+
+    AddToGroup(aRegistration);
+  }
+
+  void TickList::AddToGroup(TickRegistration *aRegistration)
+  {
+    size_t groupIndex = 0;
+
+    while (groupIndex < mGroups.size() &&
+           mGroups[groupIndex].mRunner != aRegistration->mRunner)
+    {
+      ++groupIndex;
+    }
+
+    if (groupIndex == mGroups.size())
+    {
+      mGroups.emplace_back();
+      mGroups.back().mRunner = aRegistration->mRunner;
+    }
+
+    auto &group = mGroups[groupIndex];
+
+    aRegistration->mPending = false;
+    aRegistration->mGroup = groupIndex;
+    aRegistration->mIndex = group.mObjects.size();
+    group.mObjects.push_back(aRegistration->mObject);
+    group.mRegistrations.push_back(aRegistration);
+  }
+
+  void TickList::Remove(TickRegistration *aRegistration)
+  {
+    --mCount;
+    aRegistration->mList = nullptr;
+
+    if (aRegistration->mPending)
+    {
+      mPending[aRegistration->mIndex] = nullptr;
+      return;
+    }
+
+    // Leave a hole rather than swapping the last object in, so the order
+    // objects tick in stays the order they registered. Run may also be
+    // partway through this group. Holes are compacted out before the next
+    // run, so tearing down many objects doesn't shift the arrays per object.
+    auto &group = mGroups[aRegistration->mGroup];
+    group.mObjects[aRegistration->mIndex] = nullptr;
+    group.mRegistrations[aRegistration->mIndex] = nullptr;
+    mRemoved = true;
+  }
+
+  void TickList::Run(Event *aEvent)
+  {
+    if (mRemoved)
+    {
+      Compact();
+    }
+
+    mIterating = true;
+
+    // Groups aren't added to while iterating, so the count is stable.
+    for (auto &group : mGroups)
+    {
+      group.mRunner(group.mObjects.data(), group.mObjects.size(), aEvent);
+    }
+
+    mIterating = false;
+
+    if (false == mPending.empty())
+    {
+      auto pending = std::move(mPending);
+      mPending.clear();
+
+      for (auto registration : pending)
+      {
+        if (registration)
+        {
+          AddToGroup(registration);
+        }
+      }
+    }
+  }
+
+  void TickList::Compact()
+  {
+    mRemoved = false;
+
+    for (auto &group : mGroups)
+    {
+      size_t kept = 0;
+
+      for (size_t i = 0; i < group.mRegistrations.size(); ++i)
+      {
+        auto registration = group.mRegistrations[i];
+
+        if (nullptr == registration)
+        {
+          continue;
+        }
+
+        registration->mIndex = kept;
+        group.mObjects[kept] = group.mObjects[i];
+        group.mRegistrations[kept] = registration;
+        ++kept;
+      }
+
+      group.mObjects.resize(kept);
+      group.mRegistrations.resize(kept);
+    }
+  }
+}
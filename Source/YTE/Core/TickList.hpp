@@ -0,0 +1,112 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#pragma once
+
+#ifndef YTE_Core_TickList_hpp
+#define YTE_Core_TickList_hpp
+
+#include <cstddef>
+#include <vector>
+
+#include "YTE/Platform/TargetDefinitions.hpp"
+
+namespace YTE
+{
+  class Event;
+  class TickList;
+
+  // Where one object's tick sits in a TickList. Owned by the object that
+  // registered, removing itself from the list when destroyed.
+  class TickRegistration
+  {
+  public:
+    // Calls the same member function on aCount objects of one type.
+    using Runner = void(*)(void * const *aObjects, size_t aCount, Event *aEvent);
+
+    YTE_Shared TickRegistration(TickList *aList, void *aObject, Runner aRunner);
+    YTE_Shared ~TickRegistration();
+
+    TickRegistration(TickRegistration const&) = delete;
+    TickRegistration& operator=(TickRegistration const&) = delete;
+
+    TickList* GetList() const
+    {
+      return mList;
+    }
+
+    void* GetObject() const
+    {
+      return mObject;
+    }
+
+    Runner GetRunner() const
+    {
+      return mRunner;
+    }
+
+  private:
+    friend class TickList;
+
+    TickList *mList;
+    void *mObject;
+    Runner mRunner;
+
+    // Index into the group's arrays, or into the list's pending adds.
+    size_t mGroup;
+    size_t mIndex;
+    bool mPending;
+  };
+
+  // The objects ticked by one event, in contiguous arrays grouped by the
+  // member function they registered, so sending it is a tight loop per type
+  // rather than an indirect call per heap allocated delegate.
+  //
+  // Groups run in the order their member function was first registered, and
+  // objects within a group in the order they registered. Removal leaves a
+  // hole that's skipped, then compacted out (keeping that order) before the
+  // next run. Adding while the list is running is safe, added objects start
+  // next time.
+  class TickList
+  {
+  public:
+    TickList();
+
+    // Registrations still in the list are detached, not destroyed.
+    ~TickList();
+
+    TickList(TickList const&) = delete;
+    TickList& operator=(TickList const&) = delete;
+
+    void Add(TickRegistration *aRegistration);
+    void Remove(TickRegistration *aRegistration);
+    void Run(Event *aEvent);
+
+    bool IsEmpty() const
+    {
+      return 0 == mCount;
+    }
+
+  private:
+    struct Group
+    {
+      TickRegistration::Runner mRunner;
+      std::vector<void*> mObjects;
+      std::vector<TickRegistration*> mRegistrations;
+    };
+
+    void AddToGroup(TickRegistration *aRegistration);
+    void Compact();
+
+    std::vector<Group> mGroups;
+    std::vector<TickRegistration*> mPending;
+    size_t mCount;
+    bool mIterating;
+    bool mRemoved;
+  };
+}
+
+#endif
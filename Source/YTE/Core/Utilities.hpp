@@ -33,6 +33,7 @@
 
 #include "YTE/Platform/TargetDefinitions.hpp"
 
+#include "YTE/StandardLibrary/IndexedMultiMap.hpp"
 #include "YTE/StandardLibrary/OrderedMultiMap.hpp"
 #include "YTE/StandardLibrary/OrderedMap.hpp"
 #include "YTE/StandardLibrary/Utilities.hpp"
@@ -45,6 +46,7 @@
   #define YTEProfileName(aName) EASY_BLOCK(aName)
   #define YTEProfileFunction() EASY_FUNCTION(profiler::colors::Red)
   #define YTEProfileBlock(aName) EASY_BLOCK(aName, profiler::colors::Red)
+  #define YTEProfileValue(aName, aValue) EASY_VALUE(aName, aValue)
 #else
   namespace profiler
   {
@@ -56,6 +58,7 @@
   #define YTEProfileName(aName)
   #define YTEProfileFunction()
   #define YTEProfileBlock(aName)
+  #define YTEProfileValue(aName, aValue)
 #endif
 
 namespace YTE
@@ -71,8 +74,23 @@ namespace YTE
   using FactoryMap = OrderedMap<BoundType*, UniquePointer<StringComponentFactory>>;
   using FactorySetupCallback = void(*)(FactoryMap &);
 
-  using CompositionMap = OrderedMultiMap<String, std::unique_ptr<Composition>>;
-  using ComponentMap   = OrderedMap<Type*, std::unique_ptr<Component>>;
+  // Hands components back to the ComponentPool they were created in, or
+  // deletes them if they weren't.
+  struct ComponentDeleter
+  {
+    ComponentDeleter() = default;
+
+    // So components made by std::make_unique can be stored too.
+    template <typename tType>
+    ComponentDeleter(std::default_delete<tType> const&)
+    {
+    }
+
+    YTE_Shared void operator()(Component *aComponent) const;
+  };
+
+  using CompositionMap = IndexedMultiMap<String, std::unique_ptr<Composition>>;
+  using ComponentMap   = OrderedMap<Type*, UniquePointer<Component, ComponentDeleter>>;
 }
 
 YTEDeclareExternalType(glm::i32vec2);
@@ -857,12 +857,16 @@ namespace YTE
     : Component(aOwner, aSpace)
     , mDefaultAnimation(nullptr)
     , mCurrentAnimation(nullptr)
+    , mAnimateTask(FrameScheduler::cInvalidTask)
+    , mKeyFrameChanged(false)
   {
     mEngine = aSpace->GetEngine();
   }
 
   Animator::~Animator()
   {
+    mEngine->GetFrameScheduler()->RemoveTask(mAnimateTask);
+
     if (mOwner->GetIsBeingDeleted() == false)
     {
       if (mModel->GetInstantiatedModel().size())
@@ -888,11 +892,30 @@ namespace YTE
       it.second->Initialize(mModel, mEngine);
     }
 
-    mEngine->RegisterEvent<&Animator::Update>(Events::AnimationUpdate, this);
+    // Animators sharing a Mesh also share its Skeleton, so those have to be
+    // posed one at a time.
+    std::vector<FrameScheduler::Resource> writes{ this };
+
+    if (auto mesh = mModel->GetMesh())
+    {
+      writes.push_back(&mesh->mSkeleton);
+    }
+
+    mAnimateTask = mEngine->GetFrameScheduler()->AddTask(FramePhase::Animation,
+                                                         "Animator::Animate",
+                                                         [this](LogicUpdate *aEvent) { Animate(aEvent); },
+                                                         {},
+                                                         std::move(writes));
+
+    mEngine->RegisterTick<&Animator::Update>(Events::AnimationUpdate, this);
   }
 
-  void Animator::Update(LogicUpdate *aEvent)
+  void Animator::Animate(LogicUpdate *aEvent)
   {
+    YTEProfileFunction();
+
+    mKeyFrameChanged = false;
+
     if (!mCurrentAnimation)
     {
       if (!mNextAnimations.empty())
@@ -927,11 +950,7 @@ namespace YTE
       }
       else
       {
-        KeyFrameChanged keyChange;
-        keyChange.animation = mCurrentAnimation->mName;
-        keyChange.time = mCurrentAnimation->mElapsedTime;
-
-        mOwner->SendEvent(Events::KeyFrameChanged, &keyChange);
+        mKeyFrameChanged = true;
       }
     }
 
@@ -939,14 +958,41 @@ namespace YTE
     {
       mCurrentAnimation->Animate();
 
+      // Copy the bones out now, the Skeleton may be shared with another
+      // Animator that poses it next.
       for (int i = 0; i < mCurrentAnimation->GetSkeleton()->GetBoneData().size(); ++i)
       {
         mCurrentAnimation->GetUBOAnim()->mBones[i] = mCurrentAnimation->GetSkeleton()->GetBoneData()[i].mFinalTransformation;
       }
+    }
+  }
 
-      // cause update to graphics card
-      mModel->GetInstantiatedModel()[0]->UpdateUBOAnimation(mCurrentAnimation->GetUBOAnim());
+  void Animator::Update(LogicUpdate *aEvent)
+  {
+    UnusedArguments(aEvent);
+
+    // Listeners may change the current animation, but this frame's bones
+    // are in the one that was posed.
+    auto animation = mCurrentAnimation;
+
+    if (nullptr == animation)
+    {
+      return;
     }
+
+    if (mKeyFrameChanged)
+    {
+      mKeyFrameChanged = false;
+
+      KeyFrameChanged keyChange;
+      keyChange.animation = animation->mName;
+      keyChange.time = animation->mElapsedTime;
+
+      mOwner->SendEvent(Events::KeyFrameChanged, &keyChange);
+    }
+
+    // cause update to graphics card
+    mModel->GetInstantiatedModel()[0]->UpdateUBOAnimation(animation->GetUBOAnim());
   }
 
   void Animator::PlayAnimationSet(std::string aAnimation)
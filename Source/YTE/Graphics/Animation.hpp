@@ -13,6 +13,7 @@
 #include "YTE/Core/EventHandler.hpp"
 #include "YTE/Core/ForwardDeclarations.hpp"
 #include "YTE/Core/Component.hpp"
+#include "YTE/Core/FrameScheduler.hpp"
 
 #include "YTE/Graphics/ForwardDeclarations.hpp"
 #include "YTE/Graphics/Generics/Mesh.hpp"
@@ -233,6 +234,11 @@ namespace YTE
 
     YTE_Shared void Initialize() override;
 
+    // Poses the skeleton, run as a FrameScheduler task ahead of the
+    // AnimationUpdate event.
+    YTE_Shared void Animate(LogicUpdate* aEvent);
+
+    // Sends KeyFrameChanged and uploads the bones, on AnimationUpdate.
     YTE_Shared void Update(LogicUpdate* aEvent);
 
     YTE_Shared void PlayAnimationSet(std::string aAnimation);
@@ -266,6 +272,9 @@ namespace YTE
     std::queue<Animation*> mNextAnimations;
 
     std::map<std::string, Animation*> mAnimations;
+
+    FrameScheduler::TaskId mAnimateTask;
+    bool mKeyFrameChanged;
   };
 }
 
@@ -146,7 +146,7 @@ namespace YTE
 
     mGraphicsView->RegisterEvent<&Camera::RendererResize>(Events::RendererResize, this);
     mGraphicsView->RegisterEvent<&Camera::SurfaceGainedEvent>(Events::SurfaceGained, this);
-    mSpace->RegisterEvent<&Camera::Update>(Events::FrameUpdate, this);
+    mSpace->RegisterTick<&Camera::Update>(Events::FrameUpdate, this);
     mOwner->RegisterEvent<&Camera::TransformEvent>(Events::PositionChanged, this);
     mOwner->RegisterEvent<&Camera::OrientationEvent>(Events::OrientationChanged, this);
 
@@ -197,6 +197,8 @@ namespace YTE
     , mStepsCount(5)
     , mInstanceCount(1)
     , mConstructing(true)
+    , mSimulateTask(FrameScheduler::cInvalidTask)
+    , mSimulated(false)
   {
     auto self = mData.ConstructAndGet<KissFFTData>();
 
@@ -229,13 +231,21 @@ namespace YTE
     mOwner->RegisterEvent<&FFT_WaterSimulation::TransformEvent>(Events::PositionChanged, this);
     mOwner->RegisterEvent<&FFT_WaterSimulation::TransformEvent>(Events::ScaleChanged, this);
     mOwner->RegisterEvent<&FFT_WaterSimulation::TransformEvent>(Events::RotationChanged, this);
-    mSpace->RegisterEvent<&FFT_WaterSimulation::EditorUpdate>(Events::FrameUpdate, this);
-    mSpace->RegisterEvent<&FFT_WaterSimulation::Update>(Events::LogicUpdate, this);
+    mSpace->RegisterTick<&FFT_WaterSimulation::EditorUpdate>(Events::FrameUpdate, this);
+    mSpace->RegisterTick<&FFT_WaterSimulation::Update>(Events::LogicUpdate, this);
     mTransform = mOwner->GetComponent<Transform>();
 
     auto engine = mOwner->GetEngine();
     mJobSystem = engine->GetComponent<JobSystem>();
 
+    // Reads the Space so it waits on that Space's physics step, which may
+    // move us.
+    mSimulateTask = engine->GetFrameScheduler()->AddTask(FramePhase::Space,
+                                                         "FFT_WaterSimulation::Simulate",
+                                                         [this](LogicUpdate *aEvent) { Simulate(aEvent); },
+                                                         { mSpace },
+                                                         { this });
+
     mConstructing = false;
 
     Destruct();
@@ -368,6 +378,7 @@ namespace YTE
   // ------------------------------------
   FFT_WaterSimulation::~FFT_WaterSimulation()
   {
+    mSpace->GetEngine()->GetFrameScheduler()->RemoveTask(mSimulateTask);
     Destruct();
     StopKFFT();
   }
@@ -425,18 +436,19 @@ namespace YTE
   // ------------------------------------
   void FFT_WaterSimulation::RunKFFT()
   {
+    auto self = mData.Get<KissFFTData>();
+
+    std::array<kiss_fft_cpx*, 5> arrays{ self->mH_Tilde.GetKFFTArray(),
+                                         self->mH_TildeSlopeX.GetKFFTArray(),
+                                         self->mH_TildeSlopeZ.GetKFFTArray(),
+                                         self->mH_TildeDX.GetKFFTArray(),
+                                         self->mH_TildeDZ.GetKFFTArray() };
+
     // perform the FFT on the rows of the water
-    auto handle1 = mJobSystem->QueueJobThisThread([this](JobHandle& handle)->Any { return this->MT_A(handle); });
-    auto handle2 = mJobSystem->QueueJobThisThread([this](JobHandle& handle)->Any { return this->MT_B(handle); });
-    auto handle3 = mJobSystem->QueueJobThisThread([this](JobHandle& handle)->Any { return this->MT_C(handle); });
-    auto handle4 = mJobSystem->QueueJobThisThread([this](JobHandle& handle)->Any { return this->MT_D(handle); });
-    auto handle5 = mJobSystem->QueueJobThisThread([this](JobHandle& handle)->Any { return this->MT_E(handle); });
-
-    mJobSystem->WaitThisThread(handle1);
-    mJobSystem->WaitThisThread(handle2);
-    mJobSystem->WaitThisThread(handle3);
-    mJobSystem->WaitThisThread(handle4);
-    mJobSystem->WaitThisThread(handle5);
+    mJobSystem->ParallelFor(0, arrays.size(), 1, [self, &arrays](size_t aIndex)
+    {
+      kiss_fftnd(self->mKFFTConfig[aIndex], arrays[aIndex], arrays[aIndex]);
+    });
 
     // original
     //kiss_fftnd(mKFFTConfig, mH_Tilde.GetKFFTArray(), mH_Tilde.GetKFFTArray());
@@ -1036,8 +1048,33 @@ namespace YTE
       mResetNeeded = false;
     }
 
+    // Spaces unpaused or finished loading this frame weren't simulated yet.
+    if (false == mSimulated)
+    {
+      UpdateTime(aEvent->Dt);
+      WaveGeneration();
+    }
+
+    mSimulated = false;
+    UpdateHeightmap();
+  }
+
+
+  // ------------------------------------
+  void FFT_WaterSimulation::Simulate(LogicUpdate* aEvent)
+  {
+    YTEProfileFunction();
+
+    // Resets rebuild the heightmap, so they're left to Update. Otherwise only
+    // simulate if the Space will send LogicUpdate this frame.
+    if (mResetNeeded || false == mSpace->GetFinishedLoading() || mSpace->IsPaused())
+    {
+      return;
+    }
+
     UpdateTime(aEvent->Dt);
-    Render();
+    WaveGeneration();
+    mSimulated = true;
   }
 
 
@@ -11,6 +11,7 @@
 
 // YTE
 #include "YTE/Core/Component.hpp"
+#include "YTE/Core/FrameScheduler.hpp"
 #include "YTE/Core/ForwardDeclarations.hpp"
 
 #include "YTE/Graphics/BaseModel.hpp"
@@ -130,6 +131,12 @@ namespace YTE
     /*******************/
     YTE_Shared void WaveGeneration();
 
+    /*******************/
+    // Advances and generates the waves on the JobSystem ahead of the Space's
+    // update, leaving the heightmap upload to Update
+    /*******************/
+    YTE_Shared void Simulate(LogicUpdate *aEvent);
+
     /*******************/
     // Updates the time of the sinusoid translations
     // Note that a dt value doesnt work, the FFT and DFT translate the sinusoids based on how
@@ -280,6 +287,8 @@ namespace YTE
     bool mResetNeeded;
     int mInstanceCount;
     JobSystem* mJobSystem;
+    FrameScheduler::TaskId mSimulateTask;
+    bool mSimulated;
 
     bool mRunWithEngineUpdate;
     bool mRunInSteps;
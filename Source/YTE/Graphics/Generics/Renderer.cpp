@@ -4,6 +4,7 @@
 ///////////////////
 
 #include "YTE/Core/Engine.hpp"
+#include "YTE/Core/FrameScheduler.hpp"
 
 #include "YTE/Graphics/Generics/InstantiatedModel.hpp"
 #include "YTE/Graphics/Generics/InstantiatedLight.hpp"
@@ -16,6 +17,23 @@
 
 namespace YTE
 {
+  YTEDefineEvent(MeshLoaded);
+  YTEDefineEvent(TextureLoaded);
+
+  YTEDefineType(MeshLoaded)
+  {
+    RegisterType<MeshLoaded>();
+    TypeBuilder<MeshLoaded> builder;
+    builder.Field<&MeshLoaded::Filename>("Filename", PropertyBinding::Get);
+  }
+
+  YTEDefineType(TextureLoaded)
+  {
+    RegisterType<TextureLoaded>();
+    TypeBuilder<TextureLoaded> builder;
+    builder.Field<&TextureLoaded::Filename>("Filename", PropertyBinding::Get);
+  }
+
   YTEDefineType(Renderer)
   {
     RegisterType<Renderer>();
@@ -26,6 +44,8 @@ namespace YTE
   Renderer::Renderer(Engine *aEngine)  
     : mJobSystem{ aEngine->GetComponent<JobSystem>() }
   {
+    RegisterEvent<&Renderer::OnMeshLoaded>(Events::MeshLoaded, this);
+    RegisterEvent<&Renderer::OnTextureLoaded>(Events::TextureLoaded, this);
   }
 
   Renderer::~Renderer()
@@ -200,6 +220,8 @@ namespace YTE
       return RequestMesh(aFilename);
     }
     auto jobHandle = reqIt->second;
+
+    // Never hold a lock across a wait, we may come back on another thread.
     reqLock.unlock();
 
     mJobSystem->WaitThisThread(jobHandle);
@@ -212,7 +234,7 @@ namespace YTE
     }
     baseLock.unlock();
 
-    std::unique_lock<std::shared_mutex> reqUniqueLock(mBaseMeshesMutex);
+    std::unique_lock<std::shared_mutex> reqUniqueLock(mRequestedMeshesMutex);
     reqIt = mRequestedMeshes.find(aFilename);
     if (reqIt != mRequestedMeshes.end())
     {
@@ -247,6 +269,8 @@ namespace YTE
       return RequestTexture(aFilename);
     }
     auto jobHandle = reqIt->second;
+
+    // Never hold a lock across a wait, we may come back on another thread.
     reqLock.unlock();
 
     mJobSystem->WaitThisThread(jobHandle);
@@ -259,7 +283,7 @@ namespace YTE
     }
     baseLock.unlock();
 
-    std::unique_lock<std::shared_mutex> reqUniqueLock(mBaseTexturesMutex);
+    std::unique_lock<std::shared_mutex> reqUniqueLock(mRequestedTexturesMutex);
     reqIt = mRequestedTextures.find(aFilename);
     if (reqIt != mRequestedTextures.end())
     {
@@ -299,11 +323,18 @@ namespace YTE
     }
 
     // Not in the futures map, add it.
+    // Imports can take seconds, keep them off the frame workers.
     mRequestedMeshes[aMeshFile] = mJobSystem->QueueJobThisThread([this ,aMeshFile](JobHandle& handle)->Any {
       UnusedArguments(handle);
       auto mesh = new Mesh(this, aMeshFile);
+
+      MeshLoaded loaded;
+      loaded.Filename = aMeshFile;
+      loaded.LoadedMesh = mesh;
+      PostEvent(Events::MeshLoaded, std::move(loaded), FramePhase::GraphicsData);
+
       return Any{ mesh };
-    });
+    }, JobPriority::IO);
     return nullptr;
   }
 
@@ -329,11 +360,61 @@ namespace YTE
     }
 
     // Not in the futures map, add it.
-    mRequestedTextures[aFilename] = mJobSystem->QueueJobThisThread([aFilename](JobHandle& handle)->Any {
+    mRequestedTextures[aFilename] = mJobSystem->QueueJobThisThread([this, aFilename](JobHandle& handle)->Any {
       UnusedArguments(handle);
       auto texture = new Texture(aFilename);
+
+      TextureLoaded loaded;
+      loaded.Filename = aFilename;
+      loaded.LoadedTexture = texture;
+      PostEvent(Events::TextureLoaded, std::move(loaded), FramePhase::GraphicsData);
+
       return Any{ texture };
-    });
+    }, JobPriority::IO);
     return nullptr;
   }
+
+  // Whichever of these and GetBaseMesh/GetBaseTexture gets to the load first
+  // takes ownership of it, the other finds it already in the base map. If
+  // something else got the file into the map first, this load is a duplicate
+  // and is destroyed (after unlocking).
+  void Renderer::OnMeshLoaded(MeshLoaded *aEvent)
+  {
+    std::unique_ptr<Mesh> mesh{ aEvent->LoadedMesh };
+
+    std::unique_lock<std::shared_mutex> baseLock(mBaseMeshesMutex);
+    auto baseIt = mBaseMeshes.find(aEvent->Filename);
+    if (baseIt == mBaseMeshes.end())
+    {
+      mBaseMeshes[aEvent->Filename] = std::move(mesh);
+    }
+    else if (baseIt->second.get() == mesh.get())
+    {
+      mesh.release();
+    }
+    baseLock.unlock();
+
+    std::unique_lock<std::shared_mutex> reqLock(mRequestedMeshesMutex);
+    mRequestedMeshes.erase(aEvent->Filename);
+  }
+
+  void Renderer::OnTextureLoaded(TextureLoaded *aEvent)
+  {
+    std::unique_ptr<Texture> texture{ aEvent->LoadedTexture };
+
+    std::unique_lock<std::shared_mutex> baseLock(mBaseTexturesMutex);
+    auto baseIt = mBaseTextures.find(aEvent->Filename);
+    if (baseIt == mBaseTextures.end())
+    {
+      mBaseTextures[aEvent->Filename] = std::move(texture);
+    }
+    else if (baseIt->second.get() == texture.get())
+    {
+      texture.release();
+    }
+    baseLock.unlock();
+
+    std::unique_lock<std::shared_mutex> reqLock(mRequestedTexturesMutex);
+    mRequestedTextures.erase(aEvent->Filename);
+  }
 }
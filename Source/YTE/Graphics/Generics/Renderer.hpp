@@ -28,6 +28,30 @@
 
 namespace YTE
 {
+  // Posted to the Renderer by the job that loaded it, delivered at the start
+  // of GraphicsDataUpdate. By then the Renderer owns it, so listeners can
+  // GetBaseMesh/GetBaseTexture without waiting.
+  YTEDeclareEvent(MeshLoaded);
+  YTEDeclareEvent(TextureLoaded);
+
+  class MeshLoaded : public Event
+  {
+  public:
+    YTEDeclareType(MeshLoaded);
+
+    std::string Filename;
+    Mesh *LoadedMesh;
+  };
+
+  class TextureLoaded : public Event
+  {
+  public:
+    YTEDeclareType(TextureLoaded);
+
+    std::string Filename;
+    Texture *LoadedTexture;
+  };
+
   class Renderer : public EventHandler
   {
   public:
@@ -106,6 +130,8 @@ namespace YTE
     virtual GPUAllocator* MakeAllocator(std::string const& aAllocatorType, size_t aBlockSize) = 0;
 
   protected:
+    void OnMeshLoaded(MeshLoaded *aEvent);
+    void OnTextureLoaded(TextureLoaded *aEvent);
 
     std::unordered_map<std::string, JobHandle> mRequestedMeshes;
     std::shared_mutex mRequestedMeshesMutex;
@@ -91,10 +91,8 @@ namespace YTE
 
   void InfluenceMap::Initialize()
   {
-    mOwner->RegisterEvent<&InfluenceMap::TransformUpdate>(Events::PositionChanged, this);
-    mOwner->RegisterEvent<&InfluenceMap::TransformUpdate>(Events::RotationChanged, this);
-    mOwner->RegisterEvent<&InfluenceMap::TransformUpdate>(Events::ScaleChanged, this);
-    mEngine->RegisterEvent<&InfluenceMap::Update>(Events::LogicUpdate, this);
+    mOwner->RegisterDeferredEvent<&InfluenceMap::TransformUpdate>(Events::TransformChanged, this);
+    mEngine->RegisterTick<&InfluenceMap::Update>(Events::LogicUpdate, this);
 
     mTransform = mOwner->GetComponent<Transform>(); 
     mDrawer = std::make_unique<LineDrawer>(mOwner->GetGUID().ToIdentifierString(), mGraphicsView->GetRenderer(), mGraphicsView);
@@ -151,7 +149,7 @@ namespace YTE
 
     if (mTransform && mSetTransform == false)
     {
-      mEngine->DeregisterEvent<&InfluenceMap::Update>(Events::LogicUpdate,  this);
+      mEngine->DeregisterTick<&InfluenceMap::Update>(Events::LogicUpdate,  this);
       if (mInstantiatedInfluenceMap)
       {
         mInstantiatedInfluenceMap->SetCenter(mTransform->GetTranslation());
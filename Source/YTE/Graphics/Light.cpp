@@ -94,10 +94,8 @@ namespace YTE
 
   void Light::Initialize()
   {
-    mOwner->RegisterEvent<&Light::TransformUpdate>(Events::PositionChanged, this);
-    mOwner->RegisterEvent<&Light::TransformUpdate>(Events::RotationChanged, this);
-    mOwner->RegisterEvent<&Light::TransformUpdate>(Events::ScaleChanged, this);
-    mEngine->RegisterEvent<&Light::Update>(Events::LogicUpdate, this);
+    mOwner->RegisterDeferredEvent<&Light::TransformUpdate>(Events::TransformChanged, this);
+    mEngine->RegisterTick<&Light::Update>(Events::LogicUpdate, this);
 
     mTransform = mOwner->GetComponent<Transform>(); 
 
@@ -141,7 +139,7 @@ namespace YTE
 
     if (mTransform && mSetTransform == false)
     {
-      mEngine->DeregisterEvent<&Light::Update>(Events::LogicUpdate,  this);
+      mEngine->DeregisterTick<&Light::Update>(Events::LogicUpdate,  this);
       if (mInstantiatedLight)
       {
         mInstantiatedLight->SetDirection(GetDirectionFromTransform(mTransform));
@@ -149,9 +149,7 @@ namespace YTE
   {
     mWindow = mSpace->GetComponent<GraphicsView>()->GetWindow();
 
-    mOwner->RegisterEvent<&Model::TransformUpdate>(Events::PositionChanged, this);
-    mOwner->RegisterEvent<&Model::TransformUpdate>(Events::RotationChanged, this);
-    mOwner->RegisterEvent<&Model::TransformUpdate>(Events::ScaleChanged, this);
+    mOwner->RegisterDeferredEvent<&Model::TransformUpdate>(Events::TransformChanged, this);
     mTransform = mOwner->GetComponent<Transform>();
     mConstructing = false;
     Create();
@@ -131,7 +131,7 @@ namespace YTE
 
   void ParticleEmitter::Initialize()
   {
-    GetSpace()->RegisterEvent<&ParticleEmitter::Update>(Events::FrameUpdate, this);
+    GetSpace()->RegisterTick<&ParticleEmitter::Update>(Events::FrameUpdate, this);
 
     mGraphicsView = mSpace->GetComponent<GraphicsView>();
 
@@ -82,9 +82,7 @@ namespace YTE
     mWindow = mSpace->GetComponent<GraphicsView>()->GetWindow();
     mTransform = mOwner->GetComponent<Transform>();
 
-    mOwner->RegisterEvent<&Skybox::TransformUpdate>(Events::PositionChanged, this);
-    mOwner->RegisterEvent<&Skybox::TransformUpdate>(Events::RotationChanged, this);
-    mOwner->RegisterEvent<&Skybox::TransformUpdate>(Events::ScaleChanged, this);
+    mOwner->RegisterDeferredEvent<&Skybox::TransformUpdate>(Events::TransformChanged, this);
 
     CreateSkybox();
     mConstructing = false;
@@ -107,9 +107,7 @@ namespace YTE
     mWindow = mSpace->GetComponent<GraphicsView>()->GetWindow();
     mTransform = mOwner->GetComponent<Transform>();
 
-    mOwner->RegisterEvent<&Sprite::TransformUpdate>(Events::PositionChanged, this);
-    mOwner->RegisterEvent<&Sprite::TransformUpdate>(Events::RotationChanged, this);
-    mOwner->RegisterEvent<&Sprite::TransformUpdate>(Events::ScaleChanged, this);
+    mOwner->RegisterDeferredEvent<&Sprite::TransformUpdate>(Events::TransformChanged, this);
 
     CreateSprite();
   }
@@ -181,11 +179,11 @@ namespace YTE
 
     if (aAnimating)
     {
-      mSpace->RegisterEvent<&Sprite::Update>(Events::LogicUpdate, this);
+      mSpace->RegisterTick<&Sprite::Update>(Events::LogicUpdate, this);
     }
     else
     {
-      mSpace->DeregisterEvent<&Sprite::Update>(Events::LogicUpdate,  this);
+      mSpace->DeregisterTick<&Sprite::Update>(Events::LogicUpdate,  this);
     }
   }
 
@@ -147,10 +147,10 @@ namespace YTE
     mWindow = mSpace->GetComponent<GraphicsView>()->GetWindow();
     mTransform = mOwner->GetComponent<Transform>();
 
-    mSpace->RegisterEvent<&SpriteText::OnStart>(Events::LogicUpdate, this);
+    mSpace->RegisterTick<&SpriteText::OnStart>(Events::LogicUpdate, this);
 
-    mOwner->RegisterEvent<&SpriteText::TransformUpdate>(Events::PositionChanged, this);
-    mOwner->RegisterEvent<&SpriteText::TransformUpdate>(Events::RotationChanged, this);
+    mOwner->RegisterDeferredEvent<&SpriteText::TransformUpdate>(Events::PositionChanged, this);
+    mOwner->RegisterDeferredEvent<&SpriteText::TransformUpdate>(Events::RotationChanged, this);
     //mOwner->RegisterEvent<&SpriteText::TransformUpdate>(Events::ScaleChanged, this);
 
     PrepareFont();
@@ -396,7 +396,7 @@ namespace YTE
   void SpriteText::OnStart(LogicUpdate *)
   {
     mTransform->SetWorldScale(glm::vec3(1.0f));
-    mSpace->DeregisterEvent<&SpriteText::OnStart>(Events::LogicUpdate,  this);
+    mSpace->DeregisterTick<&SpriteText::OnStart>(Events::LogicUpdate,  this);
   }
 
   void SpriteText::TransformUpdate(TransformChanged *aEvent)
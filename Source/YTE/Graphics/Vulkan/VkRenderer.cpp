@@ -34,6 +34,7 @@ namespace YTE
                          size_t aSize, 
                          size_t aOffset)
   {
+    std::lock_guard<std::mutex> lock(mAddMutex);
     mReferences.emplace_back(aBuffer, aOffset, aSize);
     mData.insert(mData.end(), aData, aData + aSize);
   }
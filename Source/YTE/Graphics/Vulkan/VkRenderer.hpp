@@ -8,6 +8,7 @@
 #ifndef YTE_Graphics_Vulkan_VkRenderer_hpp
 #define YTE_Graphics_Vulkan_VkRenderer_hpp
 
+#include <mutex>
 #include <unordered_map>
 
 #include "YTE/Graphics/GPUBuffer.hpp"
@@ -41,6 +42,7 @@ namespace YTE
       size_t mSize;
     };
 
+    // Safe to call from jobs running during a frame phase.
     void Add(std::shared_ptr<vkhlf::Buffer> const& aBuffer, u8 const* aData, size_t aSize, size_t aOffset);
 
     template <typename tType>
@@ -55,6 +57,7 @@ namespace YTE
     std::vector<VkUBOReference> mReferences;
     std::shared_ptr<vkhlf::Buffer> mMappingBuffer;
     VkRenderer* mRenderer;
+    std::mutex mAddMutex;
     //size_t mBytesLastUsed = 0;
   };
 
@@ -24,7 +24,7 @@ namespace YTE
   Body::Body(Composition *aOwner, Space *aSpace)
     : Component(aOwner, aSpace)
   {
-    mSpace->RegisterEvent<&Body::OnLogicUpdate>(Events::LogicUpdate, this);
+    mSpace->RegisterTick<&Body::OnLogicUpdate>(Events::LogicUpdate, this);
   };
 
   Body::~Body()
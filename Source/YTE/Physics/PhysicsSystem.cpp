@@ -67,7 +67,9 @@ namespace YTE
 
   PhysicsSystem::PhysicsSystem(Composition *aOwner, Space *aSpace)
     : Component(aOwner, aSpace)
+    , mStepTask(FrameScheduler::cInvalidTask)
     , mDebugDraw(false)
+    , mStepped(false)
   {
     
 
@@ -100,7 +102,7 @@ namespace YTE
 
   PhysicsSystem::~PhysicsSystem()
   {
-
+    mOwner->GetEngine()->GetFrameScheduler()->RemoveTask(mStepTask);
   }
 
 
@@ -111,6 +113,15 @@ namespace YTE
                                                  renderer,
                                                  mOwner->GetComponent<GraphicsView>());
     mDynamicsWorld->setDebugDrawer(mDebugDrawer.get());
+
+    // Stepping only writes this Space's Bullet world, and reads the
+    // Transforms of its kinematic bodies. Moving the Transforms (and so
+    // everything listening to them) waits for OnPhysicsUpdate.
+    mStepTask = mOwner->GetEngine()->GetFrameScheduler()->AddTask(FramePhase::Space,
+                                                                  "PhysicsSystem::Step",
+                                                                  [this](LogicUpdate *aEvent) { Step(aEvent); },
+                                                                  {},
+                                                                  { this, mSpace });
   }
 
   void PhysicsSystem::ToggleDebugDraw()
@@ -156,17 +167,56 @@ namespace YTE
     UnusedArguments(aEvent);
   }
 
-  void PhysicsSystem::OnPhysicsUpdate(LogicUpdate *aEvent)
+  void PhysicsSystem::Step(LogicUpdate *aEvent)
   {
-    UnusedArguments(aEvent);
     YTEProfileFunction();
 
+    // Only step if the Space will send PhysicsUpdate this frame.
+    if (false == mSpace->GetFinishedLoading() || mSpace->IsPaused())
+    {
+      return;
+    }
+
     mDynamicsWorld->updateAabbs();
     mDynamicsWorld->stepSimulation(static_cast<float>(aEvent->Dt), 10);
+    mStepped = true;
+  }
 
+  void PhysicsSystem::OnPhysicsUpdate(LogicUpdate *aEvent)
+  {
+    YTEProfileFunction();
+
+    // Spaces created or unpaused during this frame haven't been stepped yet.
+    if (false == mStepped)
+    {
+      mDynamicsWorld->updateAabbs();
+      mDynamicsWorld->stepSimulation(static_cast<float>(aEvent->Dt), 10);
+    }
+
+    mStepped = false;
+
+    ApplyMotionStates();
     DispatchCollisionEvents();
   }
 
+  void PhysicsSystem::ApplyMotionStates()
+  {
+    YTEProfileFunction();
+
+    auto &objects = mDynamicsWorld->getCollisionObjectArray();
+
+    for (int i = 0; i < objects.size(); ++i)
+    {
+      auto body = btRigidBody::upcast(objects[i]);
+
+      // Every motion state we give Bullet is one of ours, see RigidBody.
+      if (nullptr != body && nullptr != body->getMotionState())
+      {
+        static_cast<MotionState*>(body->getMotionState())->ApplyWorldTransform();
+      }
+    }
+  }
+
   void PhysicsSystem::DispatchCollisionEvents(void)
   {      
     auto numManifolds = mDispatcher->getNumManifolds();
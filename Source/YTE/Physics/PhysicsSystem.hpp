@@ -13,6 +13,7 @@
 #include "btBulletDynamicsCommon.h"
 
 #include "YTE/Core/Component.hpp"
+#include "YTE/Core/FrameScheduler.hpp"
 
 #include "YTE/Physics/ForwardDeclarations.hpp"
 #include "YTE/Physics/DebugDraw.hpp"
@@ -57,6 +58,15 @@ namespace YTE
     YTE_Shared void SetGravity(glm::vec3 aAcceleration);
 
   private:
+    // Steps this Space's world on the JobSystem, ahead of the Engine's
+    // SpaceUpdate, so separate Spaces simulate at the same time. Only the
+    // Bullet world is touched, bodies are moved by ApplyMotionStates.
+    YTE_Shared void Step(LogicUpdate *aEvent);
+
+    // Moves the Transforms of the bodies the last step moved, on the main
+    // thread, as moving them sends events to anything listening.
+    YTE_Shared void ApplyMotionStates();
+
     YTE_Shared void DispatchCollisionEvents(void);
 
     YTE_Shared void DispatchContactEvent(Composition *mainObject,
@@ -70,7 +80,9 @@ namespace YTE
     std::unique_ptr<btDiscreteDynamicsWorld> mDynamicsWorld;
     std::unique_ptr<DebugDrawer> mDebugDrawer;
 
+    FrameScheduler::TaskId mStepTask;
     bool mDebugDraw;
+    bool mStepped;
     glm::vec3 mGravityAcceleration;
   };
 
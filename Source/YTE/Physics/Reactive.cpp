@@ -46,7 +46,7 @@ namespace YTE
 
   void Reactive::Initialize()
   {
-    mSpace->RegisterEvent<&Reactive::OnLogicUpdate>(Events::LogicUpdate, this);
+    mSpace->RegisterTick<&Reactive::OnLogicUpdate>(Events::LogicUpdate, this);
     mOwner->RegisterEvent<&Reactive::OnCollisionStarted>(Events::CollisionStarted, this);
     mOwner->RegisterEvent<&Reactive::OnCollisionEnded>(Events::CollisionEnded, this);
 
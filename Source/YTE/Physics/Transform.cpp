@@ -25,6 +25,7 @@ namespace YTE
   YTEDefineEvent(PositionChanged);
   YTEDefineEvent(RotationChanged);
   YTEDefineEvent(ScaleChanged);
+  YTEDefineEvent(TransformChanged);
 
   YTEDefineType(TransformChanged)
   {
@@ -46,6 +47,19 @@ namespace YTE
   ///Bullet only calls the update of world transform for active objects
   void MotionState::setWorldTransform(const btTransform& centerOfMassWorldTrans)
   {
+    mWorldTransform = centerOfMassWorldTrans;
+    mMoved = true;
+  }
+
+  void MotionState::ApplyWorldTransform()
+  {
+    if (false == mMoved)
+    {
+      return;
+    }
+
+    mMoved = false;
+
     if (mKinematic)
     {
       return;
@@ -55,8 +69,8 @@ namespace YTE
     // and inform Bullet of changes.
     auto informOriginal = mTransform->GetInformPhysics();
     mTransform->SetInformPhysics(false);
-    mTransform->SetWorldTranslation(ToGlm(centerOfMassWorldTrans.getOrigin()));
-    mTransform->SetWorldRotation(ToGlm(centerOfMassWorldTrans.getRotation()));
+    mTransform->SetWorldTranslation(ToGlm(mWorldTransform.getOrigin()));
+    mTransform->SetWorldRotation(ToGlm(mWorldTransform.getRotation()));
     mTransform->SetInformPhysics(informOriginal);
   }
 
@@ -118,9 +132,9 @@ namespace YTE
     mOwner->RegisterEvent<&Transform::ParentObjectChanged>(Events::ParentChanged, this);
     if (parent)
     {
-      parent->RegisterEvent<&Transform::ParentPositionChanged>(Events::PositionChanged, this);
-      parent->RegisterEvent<&Transform::ParentScaleChanged>(Events::ScaleChanged, this);
-      parent->RegisterEvent<&Transform::ParentRotationChanged>(Events::RotationChanged, this);
+      mParentPositionChanged = parent->RegisterEvent<&Transform::ParentPositionChanged>(Events::PositionChanged, this);
+      mParentScaleChanged = parent->RegisterEvent<&Transform::ParentScaleChanged>(Events::ScaleChanged, this);
+      mParentRotationChanged = parent->RegisterEvent<&Transform::ParentRotationChanged>(Events::RotationChanged, this);
     }
   }
 
@@ -144,21 +158,18 @@ namespace YTE
 
   void Transform::ParentObjectChanged(ParentChanged *aEvent)
   {
-    auto oldParent = aEvent->mOldParent;
     auto newParent = aEvent->mNewParent;
 
-    if (oldParent)
-    {
-      oldParent->DeregisterEvent<&Transform::ParentPositionChanged>(Events::PositionChanged,  this);
-      oldParent->DeregisterEvent<&Transform::ParentScaleChanged>(Events::ScaleChanged,  this);
-      oldParent->DeregisterEvent<&Transform::ParentRotationChanged>(Events::RotationChanged,  this);
-    }
+    // Our connections are to the old parent, if we had one.
+    mParentPositionChanged.Disconnect();
+    mParentScaleChanged.Disconnect();
+    mParentRotationChanged.Disconnect();
 
     if (newParent)
     {
-      newParent->RegisterEvent<&Transform::ParentPositionChanged>(Events::PositionChanged, this);
-      newParent->RegisterEvent<&Transform::ParentScaleChanged>(Events::ScaleChanged, this);
-      newParent->RegisterEvent<&Transform::ParentRotationChanged>(Events::RotationChanged, this);
+      mParentPositionChanged = newParent->RegisterEvent<&Transform::ParentPositionChanged>(Events::PositionChanged, this);
+      mParentScaleChanged = newParent->RegisterEvent<&Transform::ParentScaleChanged>(Events::ScaleChanged, this);
+      mParentRotationChanged = newParent->RegisterEvent<&Transform::ParentRotationChanged>(Events::RotationChanged, this);
     }
 
     // set translation
@@ -497,7 +508,7 @@ namespace YTE
     return rotation;
   }
 
-  void Transform::SendTransformEvents(const std::string &aEvent,
+  void Transform::SendTransformEvents(EventId aEvent,
                                       glm::quat aLocalRotationDifference,
                                       glm::quat aWorldRotationDifference)
   {
@@ -522,7 +533,8 @@ namespace YTE
     newTransform.LocalRotationDifference = aLocalRotationDifference;
     newTransform.WorldRotationDifference = aWorldRotationDifference;
 
-    mOwner->SendEvent(aEvent, &newTransform);
+    mOwner->SendCoalescedEvent(aEvent, &newTransform);
+    mOwner->SendCoalescedEvent(Events::TransformChanged, &newTransform);
   }
 
 
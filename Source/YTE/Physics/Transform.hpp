@@ -35,6 +35,10 @@ namespace YTE
   YTEDeclareEvent(RotationChanged);
   YTEDeclareEvent(ScaleChanged);
 
+  // Any of the above, sent with SendCoalescedEvent so listeners registered
+  // with RegisterDeferredEvent hear about a frame's changes once.
+  YTEDeclareEvent(TransformChanged);
+
   class TransformChanged :public Event
   {
   public:
@@ -50,6 +54,18 @@ namespace YTE
 
     glm::quat LocalRotationDifference;
     glm::quat WorldRotationDifference;
+
+    // Takes aNewer's transform, the rotation differences accumulate.
+    void Coalesce(const TransformChanged &aNewer)
+    {
+      auto localDifference = aNewer.LocalRotationDifference * LocalRotationDifference;
+      auto worldDifference = aNewer.WorldRotationDifference * WorldRotationDifference;
+
+      *this = aNewer;
+
+      LocalRotationDifference = localDifference;
+      WorldRotationDifference = worldDifference;
+    }
   };
 
   class MotionState : public btMotionState
@@ -58,6 +74,7 @@ namespace YTE
     MotionState(Transform *aTransform, bool kinematic = false)
       : mTransform(aTransform)
       , mKinematic(kinematic)
+      , mMoved(false)
     {
 
     };
@@ -67,8 +84,15 @@ namespace YTE
 
     ///synchronizes world transform from physics to user
     ///Bullet only calls the update of world transform for active objects
+    ///
+    /// Bullet calls this while stepping, which can be on a worker, so it's
+    /// only recorded. PhysicsSystem moves the Transform on the main thread
+    /// afterwards, with ApplyWorldTransform.
     void setWorldTransform(const btTransform& centerOfMassWorldTrans) override;
 
+    // Moves the Transform to where the last step put the body, if it moved.
+    void ApplyWorldTransform();
+
     void SetKinematic(bool flag)
     {
       mKinematic = flag;
@@ -81,7 +105,9 @@ namespace YTE
 
   private:
     Transform *mTransform;
+    btTransform mWorldTransform;
     bool mKinematic;
+    bool mMoved;
   };
 
   class Transform : public Component
@@ -166,7 +192,7 @@ namespace YTE
     void SetInternalScale(const glm::vec3 &aParentScale, const glm::vec3 &aLocalScale);
     void SetInternalRotation(const glm::quat &aParentRotation, const glm::quat &aLocalRotation);
 
-    void SendTransformEvents(const std::string &aEvent,
+    void SendTransformEvents(EventId aEvent,
                              glm::quat aLocalRotationDifference = glm::quat{},
                              glm::quat aWorldRotationDifference = glm::quat{});
 
@@ -178,6 +204,11 @@ namespace YTE
     glm::vec3 mWorldScale;
     glm::quat mWorldRotation;
 
+    // Our registrations on our parent.
+    EventHandler::Connection mParentPositionChanged;
+    EventHandler::Connection mParentScaleChanged;
+    EventHandler::Connection mParentRotationChanged;
+
     bool mInformPhysics;
   };
 }
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+
+#include "YTE/StandardLibrary/PrivateImplementation.hpp"
+
+namespace YTE
+{
+  // A stack that code can be suspended on and later resumed from, possibly by
+  // another thread. Control only ever moves between fibers through SwitchTo,
+  // and a thread has to be running a fiber (see the default constructor)
+  // before it can switch to one.
+  class Fiber
+  {
+  public:
+    using EntryPoint = void(*)(void *aData);
+
+    // Turns the calling thread's own stack into a fiber. Must be destroyed on
+    // the same thread, while it's the fiber running.
+    Fiber()
+    {
+      Platform_ConvertThread();
+    }
+
+    // Runs aEntryPoint(aData) on a new stack of aStackSize bytes the first
+    // time it's switched to. aEntryPoint must never return, switch to
+    // another fiber instead.
+    Fiber(EntryPoint aEntryPoint, void *aData, size_t aStackSize)
+    {
+      Platform_Create(aEntryPoint, aData, aStackSize);
+    }
+
+    // Destroying a fiber that's suspended doesn't unwind its stack.
+    ~Fiber()
+    {
+      Platform_Destroy();
+    }
+
+    Fiber(Fiber const&) = delete;
+    Fiber& operator=(Fiber const&) = delete;
+
+    // Suspends whichever fiber is running on the calling thread and runs
+    // this one. Returns once something switches back to the suspended fiber,
+    // which may be on a different thread.
+    void SwitchTo()
+    {
+      Platform_SwitchTo();
+    }
+
+    // False if the fiber couldn't be created.
+    bool IsValid()
+    {
+      return Platform_IsValid();
+    }
+
+  private:
+    void Platform_ConvertThread();
+    void Platform_Create(EntryPoint aEntryPoint, void *aData, size_t aStackSize);
+    void Platform_Destroy();
+    void Platform_SwitchTo();
+    bool Platform_IsValid();
+
+    PrivateImplementationLocal<32> mData;
+  };
+}
@@ -80,7 +80,7 @@ namespace YTE
 
     mKeysCurrent[index] = aDown;
 
-    const std::string *state;
+    const EventId *state;
 
     // Key has been pressed.
     if (aDown)
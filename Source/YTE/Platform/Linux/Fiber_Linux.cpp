@@ -0,0 +1,163 @@
+#ifdef __linux__
+
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+#include "YTE/Platform/Fiber.hpp"
+
+namespace YTE
+{
+  namespace PlatformData
+  {
+    // A ucontext_t is far bigger than Fiber keeps inline, so it lives here.
+    struct Fiber_Context
+    {
+      ucontext_t mContext;
+      Fiber::EntryPoint mEntryPoint = nullptr;
+      void *mData = nullptr;
+
+      // Null for a converted thread, which runs on the thread's own stack.
+      void *mStack = nullptr;
+      size_t mStackSize = 0;
+    };
+
+    struct Fiber_Data
+    {
+      Fiber_Context *mContext = nullptr;
+
+      // Not set when the thread was already a fiber, that one stays as it is.
+      std::unique_ptr<Fiber_Context> mOwned;
+      bool mConverted = false;
+    };
+
+    // The fiber running on this thread, SwitchTo saves into it. Only read
+    // before switching, after we may be on another thread.
+    static thread_local Fiber_Context *tCurrentFiber = nullptr;
+
+    // makecontext only passes ints, so the context comes in halves.
+    static void FiberStart(unsigned aLow, unsigned aHigh)
+    {
+      auto pointer = (static_cast<std::uintptr_t>(aHigh) << 32) | aLow;
+      auto self = reinterpret_cast<Fiber_Context*>(pointer);
+      self->mEntryPoint(self->mData);
+
+      // Entry points must switch away rather than return, uc_link is null.
+      std::abort();
+    }
+  }
+
+
+  void Fiber::Platform_ConvertThread()
+  {
+    auto self = mData.ConstructAndGet<PlatformData::Fiber_Data>();
+
+    if (nullptr != PlatformData::tCurrentFiber)
+    {
+      self->mContext = PlatformData::tCurrentFiber;
+      return;
+    }
+
+    // Filled in by the first switch away from this thread.
+    self->mOwned = std::make_unique<PlatformData::Fiber_Context>();
+    self->mContext = self->mOwned.get();
+    self->mConverted = true;
+    PlatformData::tCurrentFiber = self->mContext;
+  }
+
+  void Fiber::Platform_Create(EntryPoint aEntryPoint, void *aData, size_t aStackSize)
+  {
+    auto self = mData.ConstructAndGet<PlatformData::Fiber_Data>();
+    auto context = std::make_unique<PlatformData::Fiber_Context>();
+
+    context->mEntryPoint = aEntryPoint;
+    context->mData = aData;
+
+    // Reserved rather than committed, most fibers never come close to the
+    // full stack. The lowest page is left inaccessible to catch overflows.
+    size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t size = ((aStackSize + page - 1) / page + 1) * page;
+
+    void *stack = mmap(nullptr,
+                       size,
+                       PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_STACK,
+                       -1,
+                       0);
+
+    if (MAP_FAILED == stack)
+    {
+      return;
+    }
+
+    mprotect(stack, page, PROT_NONE);
+
+    context->mStack = stack;
+    context->mStackSize = size;
+
+    if (0 != getcontext(&context->mContext))
+    {
+      munmap(stack, size);
+      return;
+    }
+
+    context->mContext.uc_stack.ss_sp = static_cast<char*>(stack) + page;
+    context->mContext.uc_stack.ss_size = size - page;
+    context->mContext.uc_link = nullptr;
+
+    auto pointer = reinterpret_cast<std::uintptr_t>(context.get());
+    makecontext(&context->mContext,
+                reinterpret_cast<void(*)()>(&PlatformData::FiberStart),
+                2,
+                static_cast<unsigned>(pointer & 0xFFFFFFFF),
+                static_cast<unsigned>(pointer >> 32));
+
+    self->mContext = context.get();
+    self->mOwned = std::move(context);
+  }
+
+  void Fiber::Platform_Destroy()
+  {
+    auto self = mData.Get<PlatformData::Fiber_Data>();
+
+    if (nullptr == self)
+    {
+      return;
+    }
+
+    if (self->mConverted && PlatformData::tCurrentFiber == self->mContext)
+    {
+      PlatformData::tCurrentFiber = nullptr;
+    }
+
+    if (self->mOwned && self->mOwned->mStack)
+    {
+      munmap(self->mOwned->mStack, self->mOwned->mStackSize);
+    }
+
+    mData.Release();
+  }
+
+  void Fiber::Platform_SwitchTo()
+  {
+    auto self = mData.Get<PlatformData::Fiber_Data>();
+    auto target = self->mContext;
+    auto current = PlatformData::tCurrentFiber;
+    PlatformData::tCurrentFiber = target;
+
+    swapcontext(&current->mContext, &target->mContext);
+  }
+
+  bool Fiber::Platform_IsValid()
+  {
+    auto self = mData.Get<PlatformData::Fiber_Data>();
+
+    return nullptr != self && nullptr != self->mContext;
+  }
+}
+
+#endif
@@ -0,0 +1,78 @@
+#ifdef __linux__
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "YTE/Platform/MappedFile.hpp"
+
+namespace YTE
+{
+  namespace PlatformData
+  {
+    struct MappedFile_Data
+    {
+      int mFile = -1;
+    };
+  }
+
+  void MappedFile::Platform_Open(std::string const& aFile)
+  {
+    auto self = mPlatformData.ConstructAndGet<PlatformData::MappedFile_Data>();
+
+    self->mFile = open(aFile.c_str(), O_RDONLY);
+
+    if (-1 == self->mFile)
+    {
+      return;
+    }
+
+    struct stat status;
+
+    // Empty files can't be mapped.
+    if (-1 == fstat(self->mFile, &status) || 0 == status.st_size)
+    {
+      return;
+    }
+
+    auto size = static_cast<size_t>(status.st_size);
+    void *data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, self->mFile, 0);
+
+    if (MAP_FAILED == data)
+    {
+      return;
+    }
+
+    madvise(data, size, MADV_SEQUENTIAL);
+
+    mData = static_cast<byte const*>(data);
+    mSize = size;
+  }
+
+  void MappedFile::Platform_Close()
+  {
+    auto self = mPlatformData.Get<PlatformData::MappedFile_Data>();
+
+    if (nullptr == self)
+    {
+      return;
+    }
+
+    if (nullptr != mData)
+    {
+      munmap(const_cast<byte*>(mData), mSize);
+    }
+
+    if (-1 != self->mFile)
+    {
+      close(self->mFile);
+    }
+
+    mData = nullptr;
+    mSize = 0;
+    mPlatformData.Release();
+  }
+}
+
+#endif
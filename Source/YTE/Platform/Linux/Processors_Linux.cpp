@@ -0,0 +1,133 @@
+#ifdef __linux__
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <cctype>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+
+#include "YTE/Platform/Processors.hpp"
+
+namespace YTE
+{
+  // Parses a sysfs cpu list, like "0-3,8-11".
+  static std::vector<size_t> ParseCpuList(std::string const &aList)
+  {
+    std::vector<size_t> cpus;
+    size_t position = 0;
+
+    while (position < aList.size())
+    {
+      size_t end = aList.find(',', position);
+      std::string range = aList.substr(position, end - position);
+      size_t dash = range.find('-');
+
+      if (false == range.empty() && std::isdigit(static_cast<unsigned char>(range[0])))
+      {
+        size_t first = std::stoul(range.substr(0, dash));
+        size_t last = (std::string::npos == dash) ? first : std::stoul(range.substr(dash + 1));
+
+        for (size_t cpu = first; cpu <= last; ++cpu)
+        {
+          cpus.push_back(cpu);
+        }
+      }
+
+      if (std::string::npos == end)
+      {
+        break;
+      }
+
+      position = end + 1;
+    }
+
+    return cpus;
+  }
+
+  // Without sysfs (or on a machine with one node) everything is node 0.
+  static std::unordered_map<size_t, size_t> GetNumaNodes()
+  {
+    std::unordered_map<size_t, size_t> nodes;
+    std::ifstream online("/sys/devices/system/node/online");
+    std::string list;
+
+    if (!std::getline(online, list))
+    {
+      return nodes;
+    }
+
+    for (auto node : ParseCpuList(list))
+    {
+      std::ifstream cpuList("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+      std::string cpus;
+
+      if (std::getline(cpuList, cpus))
+      {
+        for (auto cpu : ParseCpuList(cpus))
+        {
+          nodes[cpu] = node;
+        }
+      }
+    }
+
+    return nodes;
+  }
+
+  std::vector<ProcessorInformation> GetProcessors()
+  {
+    std::vector<ProcessorInformation> processors;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+
+    if (0 != sched_getaffinity(0, sizeof(set), &set))
+    {
+      return processors;
+    }
+
+    auto nodes = GetNumaNodes();
+
+    for (size_t i = 0; i < CPU_SETSIZE; ++i)
+    {
+      if (CPU_ISSET(i, &set))
+      {
+        auto it = nodes.find(i);
+        processors.push_back(ProcessorInformation{ i, (it != nodes.end()) ? it->second : 0 });
+      }
+    }
+
+    return processors;
+  }
+
+  size_t GetCurrentProcessor()
+  {
+    int cpu = sched_getcpu();
+    return (0 <= cpu) ? static_cast<size_t>(cpu) : 0;
+  }
+
+  bool SetThisThreadAffinity(std::vector<size_t> const &aProcessors)
+  {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    bool any = false;
+
+    for (auto processor : aProcessors)
+    {
+      if (processor < CPU_SETSIZE)
+      {
+        CPU_SET(processor, &set);
+        any = true;
+      }
+    }
+
+    if (false == any)
+    {
+      return false;
+    }
+
+    return 0 == pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+  }
+}
+
+#endif
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "YTE/StandardLibrary/PrivateImplementation.hpp"
+
+namespace YTE
+{
+  // A file mapped read only into memory, so formats laid out to be used in
+  // place can be read without copying them out of the file first. The data
+  // is page aligned.
+  struct MappedFile
+  {
+    MappedFile(std::string const& aFile)
+      : mData{ nullptr }
+      , mSize{ 0 }
+    {
+      Platform_Open(aFile);
+    }
+
+    MappedFile(MappedFile const&) = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+
+    ~MappedFile()
+    {
+      Platform_Close();
+    }
+
+    bool IsOpen() const
+    {
+      return nullptr != mData;
+    }
+
+    byte const* GetData() const
+    {
+      return mData;
+    }
+
+    size_t GetSize() const
+    {
+      return mSize;
+    }
+
+    private:
+    void Platform_Open(std::string const& aFile);
+    void Platform_Close();
+
+    PrivateImplementationLocal<32> mPlatformData;
+    byte const *mData;
+    size_t mSize;
+  };
+}
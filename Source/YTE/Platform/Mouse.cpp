@@ -109,7 +109,7 @@ namespace YTE
 
     mMouseCurrent[index] = aDown;
 
-    const std::string *state;
+    const EventId *state;
 
     if (aDown)
     {
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace YTE
+{
+  // A logical processor (hardware thread) the process is allowed to run on.
+  struct ProcessorInformation
+  {
+    size_t mIndex;
+    size_t mNumaNode;
+  };
+
+  // In index order. On Windows only the process's first processor group is
+  // considered, so at most 64.
+  std::vector<ProcessorInformation> GetProcessors();
+
+  // The processor the calling thread is running on right now.
+  size_t GetCurrentProcessor();
+
+  // Restricts the calling thread to aProcessors (indices, as above). Returns
+  // false if none of them are usable.
+  bool SetThisThreadAffinity(std::vector<size_t> const &aProcessors);
+}
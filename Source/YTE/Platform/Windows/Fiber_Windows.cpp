@@ -0,0 +1,99 @@
+#include "YTE/Platform/TargetDefinitions.hpp"
+#ifdef YTE_Windows
+
+#include "YTE/Platform/Windows/WindowsInclude_Windows.hpp"
+
+#include "YTE/Platform/Fiber.hpp"
+
+namespace YTE
+{
+  namespace PlatformData
+  {
+    struct Fiber_Data
+    {
+      LPVOID mFiber = nullptr;
+      Fiber::EntryPoint mEntryPoint = nullptr;
+      void *mData = nullptr;
+
+      // Only set when we converted the thread ourselves, a thread that was
+      // already a fiber stays one.
+      bool mConverted = false;
+    };
+
+    static void WINAPI FiberStart(LPVOID aParameter)
+    {
+      auto self = static_cast<Fiber_Data*>(aParameter);
+      self->mEntryPoint(self->mData);
+    }
+  }
+
+
+  void Fiber::Platform_ConvertThread()
+  {
+    auto self = mData.ConstructAndGet<PlatformData::Fiber_Data>();
+
+    self->mFiber = ConvertThreadToFiberEx(nullptr, FIBER_FLAG_FLOAT_SWITCH);
+
+    if (nullptr != self->mFiber)
+    {
+      self->mConverted = true;
+    }
+    else if (ERROR_ALREADY_FIBER == GetLastError())
+    {
+      self->mFiber = GetCurrentFiber();
+    }
+  }
+
+  void Fiber::Platform_Create(EntryPoint aEntryPoint, void *aData, size_t aStackSize)
+  {
+    auto self = mData.ConstructAndGet<PlatformData::Fiber_Data>();
+
+    self->mEntryPoint = aEntryPoint;
+    self->mData = aData;
+
+    // Commit a page up front and reserve the rest, most fibers never come
+    // close to the full stack.
+    self->mFiber = CreateFiberEx(0,
+                                 aStackSize,
+                                 FIBER_FLAG_FLOAT_SWITCH,
+                                 PlatformData::FiberStart,
+                                 self);
+  }
+
+  void Fiber::Platform_Destroy()
+  {
+    auto self = mData.Get<PlatformData::Fiber_Data>();
+
+    if (nullptr == self || nullptr == self->mFiber)
+    {
+      return;
+    }
+
+    if (self->mConverted)
+    {
+      ConvertFiberToThread();
+    }
+    else if (nullptr != self->mEntryPoint)
+    {
+      DeleteFiber(self->mFiber);
+    }
+
+    mData.Release();
+  }
+
+  void Fiber::Platform_SwitchTo()
+  {
+    auto self = mData.Get<PlatformData::Fiber_Data>();
+
+    SwitchToFiber(self->mFiber);
+  }
+
+  bool Fiber::Platform_IsValid()
+  {
+    auto self = mData.Get<PlatformData::Fiber_Data>();
+
+    return nullptr != self && nullptr != self->mFiber;
+  }
+}
+
+#endif
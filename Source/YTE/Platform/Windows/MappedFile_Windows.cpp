@@ -0,0 +1,89 @@
+#include "YTE/Platform/TargetDefinitions.hpp"
+#ifdef YTE_Windows
+
+#include "YTE/Platform/Windows/WindowsInclude_Windows.hpp"
+
+#include "YTE/Platform/MappedFile.hpp"
+
+namespace YTE
+{
+  namespace PlatformData
+  {
+    struct MappedFile_Data
+    {
+      HANDLE mFile = INVALID_HANDLE_VALUE;
+      HANDLE mMapping = nullptr;
+    };
+  }
+
+  void MappedFile::Platform_Open(std::string const& aFile)
+  {
+    auto self = mPlatformData.ConstructAndGet<PlatformData::MappedFile_Data>();
+
+    self->mFile = CreateFileA(aFile.c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                              nullptr);
+
+    if (INVALID_HANDLE_VALUE == self->mFile)
+    {
+      return;
+    }
+
+    LARGE_INTEGER size;
+
+    // Empty files can't be mapped.
+    if (FALSE == GetFileSizeEx(self->mFile, &size) || 0 == size.QuadPart)
+    {
+      return;
+    }
+
+    self->mMapping = CreateFileMappingA(self->mFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+    if (nullptr == self->mMapping)
+    {
+      return;
+    }
+
+    mData = static_cast<byte const*>(MapViewOfFile(self->mMapping, FILE_MAP_READ, 0, 0, 0));
+
+    if (nullptr != mData)
+    {
+      mSize = static_cast<size_t>(size.QuadPart);
+    }
+  }
+
+  void MappedFile::Platform_Close()
+  {
+    auto self = mPlatformData.Get<PlatformData::MappedFile_Data>();
+
+    if (nullptr == self)
+    {
+      return;
+    }
+
+    if (nullptr != mData)
+    {
+      UnmapViewOfFile(mData);
+    }
+
+    if (nullptr != self->mMapping)
+    {
+      CloseHandle(self->mMapping);
+    }
+
+    if (INVALID_HANDLE_VALUE != self->mFile)
+    {
+      CloseHandle(self->mFile);
+    }
+
+    mData = nullptr;
+    mSize = 0;
+    mPlatformData.Release();
+  }
+}
+
+#endif
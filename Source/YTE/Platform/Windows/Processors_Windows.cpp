@@ -0,0 +1,74 @@
+#include "YTE/Platform/TargetDefinitions.hpp"
+#ifdef YTE_Windows
+
+#include "YTE/Platform/Windows/WindowsInclude_Windows.hpp"
+
+#include "YTE/Platform/Processors.hpp"
+
+namespace YTE
+{
+  static constexpr size_t cMaskBits = sizeof(DWORD_PTR) * 8;
+
+  std::vector<ProcessorInformation> GetProcessors()
+  {
+    std::vector<ProcessorInformation> processors;
+
+    DWORD_PTR processMask = 0;
+    DWORD_PTR systemMask = 0;
+
+    if (FALSE == GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask))
+    {
+      return processors;
+    }
+
+    for (size_t i = 0; i < cMaskBits; ++i)
+    {
+      if (0 == (processMask & (DWORD_PTR(1) << i)))
+      {
+        continue;
+      }
+
+      PROCESSOR_NUMBER number{};
+      number.Group = 0;
+      number.Number = static_cast<BYTE>(i);
+
+      USHORT node = 0;
+
+      if (FALSE == GetNumaProcessorNodeEx(&number, &node) || 0xFFFF == node)
+      {
+        node = 0;
+      }
+
+      processors.push_back(ProcessorInformation{ i, node });
+    }
+
+    return processors;
+  }
+
+  size_t GetCurrentProcessor()
+  {
+    return GetCurrentProcessorNumber();
+  }
+
+  bool SetThisThreadAffinity(std::vector<size_t> const &aProcessors)
+  {
+    DWORD_PTR mask = 0;
+
+    for (auto processor : aProcessors)
+    {
+      if (processor < cMaskBits)
+      {
+        mask |= DWORD_PTR(1) << processor;
+      }
+    }
+
+    if (0 == mask)
+    {
+      return false;
+    }
+
+    return 0 != SetThreadAffinityMask(GetCurrentThread(), mask);
+  }
+}
+
+#endif
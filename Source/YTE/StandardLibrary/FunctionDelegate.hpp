@@ -7,32 +7,150 @@ All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
 /******************************************************************************/
 #pragma once
 
-#include "YTE/StandardLibrary/Delegate.hpp"
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
 
-#include <functional>
+#include "YTE/StandardLibrary/Delegate.hpp"
 
-// TODO (Evan): Actually finish this class
-// Easiest way would probably be to bind a member function
-// to the delegate it inherits from
 namespace YTE
 {
-  template <typename Return, typename Arg = Return>
-  struct FunctionDelegate : public Delegate<Return, Arg> {};
+  // A Delegate that owns its callable (usually a lambda) in a fixed size
+  // buffer inside of itself, so binding one never allocates. Callables that
+  // don't fit are a compile time error rather than a silent heap allocation.
+  template <typename Return, size_t tSize = 64>
+  class FunctionDelegate {};
 
-  template <typename Return, typename ...Arguments>
-  class FunctionDelegate<Return(*)(Arguments...)> : public Delegate<Return(*)(Arguments...)>
+  template <typename Return, typename ...Arguments, size_t tSize>
+  class FunctionDelegate<Return(*)(Arguments...), tSize> : public Delegate<Return(*)(Arguments...)>
   {
   public:
-    FunctionDelegate(std::function<Return(Arguments...)> aFunction)
-      : mFunction(aFunction)
+    using BaseType = Delegate<Return(*)(Arguments...)>;
+
+    FunctionDelegate()
+      : BaseType(static_cast<void*>(nullptr), nullptr)
+      , mManager(nullptr)
+    {
+    }
+
+    template <typename tCallable,
+              typename = std::enable_if_t<false == std::is_same_v<std::decay_t<tCallable>, FunctionDelegate>>>
+    FunctionDelegate(tCallable &&aCallable)
+      : BaseType(static_cast<void*>(nullptr), nullptr)
+      , mManager(nullptr)
     {
+      Construct(std::forward<tCallable>(aCallable));
     }
 
-    FunctionDelegate() = default;
+    FunctionDelegate(FunctionDelegate &&aRight)
+      : BaseType(static_cast<void*>(nullptr), nullptr)
+      , mManager(nullptr)
+    {
+      MoveFrom(aRight);
+    }
+
+    FunctionDelegate& operator=(FunctionDelegate &&aRight)
+    {
+      if (this != &aRight)
+      {
+        Clear();
+        MoveFrom(aRight);
+      }
+
+      return *this;
+    }
 
-    FunctionDelegate(FunctionDelegate &&aFunction) = default;
+    FunctionDelegate(const FunctionDelegate&) = delete;
+    FunctionDelegate& operator=(const FunctionDelegate&) = delete;
+
+    ~FunctionDelegate()
+    {
+      Clear();
+    }
+
+    template <typename tCallable>
+    void Construct(tCallable &&aCallable)
+    {
+      using CallableType = std::decay_t<tCallable>;
+
+      static_assert(sizeof(CallableType) <= tSize,
+                    "Callable is too large to be stored in this FunctionDelegate, "
+                    "capture less or by reference.");
+      static_assert(alignof(CallableType) <= alignof(std::max_align_t),
+                    "Callable is over-aligned for FunctionDelegate storage.");
+
+      Clear();
+
+      new (mStorage) CallableType(std::forward<tCallable>(aCallable));
+      this->mObject = static_cast<void*>(mStorage);
+      this->mCallerFunction = Call<CallableType>;
+      mManager = Manage<CallableType>;
+    }
+
+    void Clear()
+    {
+      if (nullptr != mManager)
+      {
+        mManager(mStorage, nullptr);
+      }
+
+      this->mObject = nullptr;
+      this->mCallerFunction = nullptr;
+      mManager = nullptr;
+    }
+
+    explicit operator bool() const
+    {
+      return nullptr != mManager;
+    }
+
+    Return operator()(Arguments... aArguments)
+    {
+      return this->Invoke(std::forward<Arguments>(aArguments)...);
+    }
+
+  private:
+    // Moves the callable in aFrom into aTo (if given) and destroys aFrom.
+    using Manager = void(*)(void *aFrom, void *aTo);
+
+    template <typename tCallable>
+    static Return Call(void *aObject, Arguments... aArguments)
+    {
+      return (*static_cast<tCallable*>(aObject))(std::forward<Arguments>(aArguments)...);
+    }
+
+    template <typename tCallable>
+    static void Manage(void *aFrom, void *aTo)
+    {
+      auto from = std::launder(static_cast<tCallable*>(aFrom));
+
+      if (nullptr != aTo)
+      {
+        new (aTo) tCallable(std::move(*from));
+      }
+
+      from->~tCallable();
+    }
+
+    void MoveFrom(FunctionDelegate &aRight)
+    {
+      if (nullptr == aRight.mManager)
+      {
+        return;
+      }
+
+      aRight.mManager(aRight.mStorage, mStorage);
+      this->mObject = static_cast<void*>(mStorage);
+      this->mCallerFunction = aRight.mCallerFunction;
+      mManager = aRight.mManager;
+
+      aRight.mObject = nullptr;
+      aRight.mCallerFunction = nullptr;
+      aRight.mManager = nullptr;
+    }
 
-  protected:
-    std::function<Return(Arguments...)> mFunction;
+    Manager mManager;
+    alignas(std::max_align_t) unsigned char mStorage[tSize];
   };
 }
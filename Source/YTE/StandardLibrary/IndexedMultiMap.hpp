@@ -0,0 +1,380 @@
+#pragma once
+
+#ifndef IndexedMultiMap_hpp
+#define IndexedMultiMap_hpp
+
+#include <cstddef>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include "YTE/StandardLibrary/Range.hpp"
+
+namespace YTE
+{
+  // A multimap that iterates in the order elements were added, with a hash
+  // index from each key to the elements with that key (also in the order
+  // they were added). Elements are allocated individually and never move,
+  // so iterators and references are only invalidated by erasing that
+  // element, and adding, erasing and finding by key are all constant time.
+  //
+  // For large flat collections that churn, where OrderedMultiMap would shift
+  // the whole array on every insert and erase.
+  template <typename tKeyType, typename tStoredType, typename tHash = std::hash<tKeyType>>
+  class IndexedMultiMap
+  {
+    struct Node;
+
+    public:
+    using ContainedType = typename std::pair<const tKeyType, tStoredType>;
+    using size_type = size_t;
+
+    // tSameKey iterators only visit elements with the same key, see FindAll.
+    template <typename tValue, bool tSameKey>
+    class NodeIterator
+    {
+      public:
+      using value_type = tValue;
+      using pointer = tValue*;
+      using reference = tValue&;
+      using difference_type = std::ptrdiff_t;
+
+      NodeIterator(Node *aNode = nullptr)
+        : mNode(aNode)
+      {
+      }
+
+      // Any iterator can be used as an iterator over the whole map, or as a
+      // const iterator.
+      template <typename tOtherValue, bool tOtherSameKey>
+      NodeIterator(NodeIterator<tOtherValue, tOtherSameKey> const& aIterator)
+        : mNode(aIterator.mNode)
+      {
+        static_assert(std::is_const<tValue>::value || !std::is_const<tOtherValue>::value,
+                      "A const iterator can't be made into a non-const one.");
+      }
+
+      NodeIterator& operator++()
+      {
+        mNode = tSameKey ? mNode->mNextSame : mNode->mNext;
+        return *this;
+      }
+
+      NodeIterator operator++(int)
+      {
+        NodeIterator previousIter{ *this };
+        ++(*this);
+        return previousIter;
+      }
+
+      template <typename tOtherValue, bool tOtherSameKey>
+      bool operator==(NodeIterator<tOtherValue, tOtherSameKey> const& aIterator) const
+      {
+        return mNode == aIterator.mNode;
+      }
+
+      template <typename tOtherValue, bool tOtherSameKey>
+      bool operator!=(NodeIterator<tOtherValue, tOtherSameKey> const& aIterator) const
+      {
+        return mNode != aIterator.mNode;
+      }
+
+      reference operator*() const
+      {
+        return mNode->mValue;
+      }
+
+      pointer operator->() const
+      {
+        return &mNode->mValue;
+      }
+
+      private:
+      template <typename, bool>
+      friend class NodeIterator;
+      friend class IndexedMultiMap;
+
+      Node *mNode;
+    };
+
+    using iterator = NodeIterator<ContainedType, false>;
+    using const_iterator = NodeIterator<const ContainedType, false>;
+
+    using key_iterator = NodeIterator<ContainedType, true>;
+
+    using range = Range<key_iterator>;
+
+    IndexedMultiMap()
+      : mFirst(nullptr)
+      , mLast(nullptr)
+      , mSize(0)
+    {
+    }
+
+    IndexedMultiMap(IndexedMultiMap const&) = delete;
+    IndexedMultiMap& operator=(IndexedMultiMap const&) = delete;
+
+    IndexedMultiMap(IndexedMultiMap &&aMap)
+      : IndexedMultiMap()
+    {
+      Swap(aMap);
+    }
+
+    IndexedMultiMap& operator=(IndexedMultiMap &&aMap)
+    {
+      Clear();
+      Swap(aMap);
+      return *this;
+    }
+
+    ~IndexedMultiMap()
+    {
+      Clear();
+    }
+
+    // Added after every element already in the map, including those with
+    // the same key.
+    template <typename tKeyPossibleType, typename... Arguments>
+    iterator Emplace(tKeyPossibleType const& aKey, Arguments &&...aStoredTypeArguments)
+    {
+      Node *node = new Node(aKey, std::forward<Arguments>(aStoredTypeArguments)...);
+
+      LinkAfter(node, mLast);
+      LinkToKey(node);
+      ++mSize;
+
+      return iterator(node);
+    }
+
+    // The first element added with aKey that's still in the map.
+    template <typename tKeyPossibleType>
+    iterator FindFirst(tKeyPossibleType const& aKey)
+    {
+      auto chain = mIndex.find(aKey);
+      return iterator((chain != mIndex.end()) ? chain->second.mFirst : nullptr);
+    }
+
+    template <typename tKeyPossibleType>
+    const_iterator FindFirst(tKeyPossibleType const& aKey) const
+    {
+      auto chain = mIndex.find(aKey);
+      return const_iterator((chain != mIndex.end()) ? chain->second.mFirst : nullptr);
+    }
+
+    // The last element added with aKey that's still in the map.
+    template <typename tKeyPossibleType>
+    iterator FindLast(tKeyPossibleType const& aKey)
+    {
+      auto chain = mIndex.find(aKey);
+      return iterator((chain != mIndex.end()) ? chain->second.mLast : nullptr);
+    }
+
+    template <typename tKeyPossibleType>
+    const_iterator FindLast(tKeyPossibleType const& aKey) const
+    {
+      auto chain = mIndex.find(aKey);
+      return const_iterator((chain != mIndex.end()) ? chain->second.mLast : nullptr);
+    }
+
+    template <typename tKeyPossibleType>
+    range FindAll(tKeyPossibleType const& aKey)
+    {
+      return range(key_iterator(FindFirst(aKey)), key_iterator());
+    }
+
+    template <typename tPossibleKey, typename tPossiblePointer, typename tComparison>
+    iterator FindIteratorByPointer(tPossibleKey aKey, tPossiblePointer aValue, tComparison aComparison)
+    {
+      for (auto possible = FindAll(aKey).begin(); possible != key_iterator(); ++possible)
+      {
+        if (aComparison(possible->second, aValue))
+        {
+          return possible;
+        }
+      }
+
+      return end();
+    }
+
+    // The element keeps its place in the map, but is now the last element
+    // added with aKey. Iterators to it are invalidated.
+    template <typename tKeyPossibleType>
+    iterator ChangeKey(iterator aIndex, tKeyPossibleType const& aKey)
+    {
+      Node *old = aIndex.mNode;
+      Node *node = new Node(aKey, std::move(old->mValue.second));
+
+      LinkAfter(node, old);
+      UnlinkFromKey(old);
+      Unlink(old);
+      delete old;
+
+      LinkToKey(node);
+
+      return iterator(node);
+    }
+
+    void Erase(iterator aValueToErase)
+    {
+      Node *node = aValueToErase.mNode;
+
+      UnlinkFromKey(node);
+      Unlink(node);
+      delete node;
+
+      --mSize;
+    }
+
+    void Clear()
+    {
+      // Emptied before anything is destroyed, in case destroying an
+      // element looks back into the map.
+      Node *node = mFirst;
+
+      mIndex.clear();
+      mFirst = nullptr;
+      mLast = nullptr;
+      mSize = 0;
+
+      while (nullptr != node)
+      {
+        Node *next = node->mNext;
+        delete node;
+        node = next;
+      }
+    }
+
+    Range<iterator> All()
+    {
+      return Range<iterator>(begin(), end());
+    };
+
+    const_iterator cbegin() const
+    {
+      return const_iterator(mFirst);
+    }
+
+    const_iterator cend() const
+    {
+      return const_iterator();
+    }
+
+    const_iterator begin() const
+    {
+      return cbegin();
+    }
+
+    const_iterator end() const
+    {
+      return cend();
+    }
+
+    iterator begin()
+    {
+      return iterator(mFirst);
+    }
+
+    iterator end()
+    {
+      return iterator();
+    }
+
+    size_type size() const { return mSize; }
+
+    private:
+    struct Node
+    {
+      template <typename tKeyPossibleType, typename... Arguments>
+      Node(tKeyPossibleType const& aKey, Arguments &&...aStoredTypeArguments)
+        : mValue(std::piecewise_construct,
+                 std::forward_as_tuple(aKey),
+                 std::forward_as_tuple(std::forward<Arguments>(aStoredTypeArguments)...))
+        , mPrevious(nullptr)
+        , mNext(nullptr)
+        , mPreviousSame(nullptr)
+        , mNextSame(nullptr)
+      {
+      }
+
+      ContainedType mValue;
+
+      // Every element, in the order they were added.
+      Node *mPrevious;
+      Node *mNext;
+
+      // Just the elements with this key, in the order they were added.
+      Node *mPreviousSame;
+      Node *mNextSame;
+    };
+
+    struct Chain
+    {
+      Node *mFirst;
+      Node *mLast;
+    };
+
+    void Swap(IndexedMultiMap &aMap)
+    {
+      std::swap(mFirst, aMap.mFirst);
+      std::swap(mLast, aMap.mLast);
+      std::swap(mSize, aMap.mSize);
+      mIndex.swap(aMap.mIndex);
+    }
+
+    // A null aPrevious adds aNode to the front.
+    void LinkAfter(Node *aNode, Node *aPrevious)
+    {
+      Node *next = aPrevious ? aPrevious->mNext : mFirst;
+
+      aNode->mPrevious = aPrevious;
+      aNode->mNext = next;
+
+      (aPrevious ? aPrevious->mNext : mFirst) = aNode;
+      (next ? next->mPrevious : mLast) = aNode;
+    }
+
+    void Unlink(Node *aNode)
+    {
+      (aNode->mPrevious ? aNode->mPrevious->mNext : mFirst) = aNode->mNext;
+      (aNode->mNext ? aNode->mNext->mPrevious : mLast) = aNode->mPrevious;
+    }
+
+    void LinkToKey(Node *aNode)
+    {
+      auto inserted = mIndex.emplace(aNode->mValue.first, Chain{ aNode, aNode });
+
+      if (inserted.second)
+      {
+        return;
+      }
+
+      Chain &chain = inserted.first->second;
+      aNode->mPreviousSame = chain.mLast;
+      chain.mLast->mNextSame = aNode;
+      chain.mLast = aNode;
+    }
+
+    void UnlinkFromKey(Node *aNode)
+    {
+      if (nullptr == aNode->mPreviousSame && nullptr == aNode->mNextSame)
+      {
+        mIndex.erase(aNode->mValue.first);
+        return;
+      }
+
+      Chain &chain = mIndex.find(aNode->mValue.first)->second;
+
+      (aNode->mPreviousSame ? aNode->mPreviousSame->mNextSame : chain.mFirst) = aNode->mNextSame;
+      (aNode->mNextSame ? aNode->mNextSame->mPreviousSame : chain.mLast) = aNode->mPreviousSame;
+    }
+
+    std::unordered_map<tKeyType, Chain, tHash> mIndex;
+    Node *mFirst;
+    Node *mLast;
+    size_type mSize;
+  };
+}
+
+#endif
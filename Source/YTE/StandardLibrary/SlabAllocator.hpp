@@ -0,0 +1,167 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "YTE/Meta/Meta.hpp"
+
+namespace YTE
+{
+  // Fixed size slots for one type, handed out from chunks that are only
+  // freed with the allocator. Every slot counts how many times it's been
+  // created in and freed, so a pointer paired with the generation it was
+  // created at can tell whether the object it pointed to is still alive,
+  // even after the slot has been reused. An odd generation is a live object,
+  // which is how the live objects can be walked in memory order.
+  //
+  // Objects still alive when the allocator is destroyed aren't destroyed.
+  template <typename tType, size_t tSlotsPerChunk = 256>
+  class SlabAllocator
+  {
+  public:
+    class Deleter
+    {
+    public:
+      Deleter(SlabAllocator *aAllocator = nullptr)
+        : mAllocator(aAllocator)
+      {
+      }
+
+      void operator()(tType *aToDelete)
+      {
+        mAllocator->Destroy(aToDelete);
+      }
+
+    private:
+      SlabAllocator *mAllocator;
+    };
+
+    SlabAllocator()
+      : mFree(nullptr)
+      , mSize(0)
+    {
+    }
+
+    SlabAllocator(SlabAllocator const&) = delete;
+    SlabAllocator& operator=(SlabAllocator const&) = delete;
+
+    Deleter GetDeleter()
+    {
+      return Deleter(this);
+    }
+
+    template <typename... tArguments>
+    tType* Create(tArguments &&...aArguments)
+    {
+      if (nullptr == mFree)
+      {
+        AddChunk();
+      }
+
+      Slot *slot = mFree;
+      mFree = slot->mNextFree;
+
+      auto object = new (&slot->mStorage) tType(std::forward<tArguments>(aArguments)...);
+
+      ++slot->mGeneration;
+      ++mSize;
+
+      return object;
+    }
+
+    void Destroy(tType *aObject)
+    {
+      aObject->~tType();
+
+      Slot *slot = ToSlot(aObject);
+      ++slot->mGeneration;
+      slot->mNextFree = mFree;
+      mFree = slot;
+      --mSize;
+    }
+
+    // Safe to call with a pointer to an object that's since been destroyed.
+    static u32 GetGeneration(tType const *aObject)
+    {
+      return ToSlot(aObject)->mGeneration;
+    }
+
+    // How many objects are alive.
+    size_t size() const
+    {
+      return mSize;
+    }
+
+    // Objects created while walking may or may not be visited, destroying
+    // the one being visited (or any other) is fine.
+    template <typename tFunction>
+    void ForEach(tFunction &&aFunction)
+    {
+      for (size_t i = 0; i < mChunks.size(); ++i)
+      {
+        ForEachInChunk(i, aFunction);
+      }
+    }
+
+    // Chunks can be walked on separate threads, so long as nothing is
+    // created or destroyed meanwhile.
+    size_t GetChunkCount() const
+    {
+      return mChunks.size();
+    }
+
+    template <typename tFunction>
+    void ForEachInChunk(size_t aChunk, tFunction &&aFunction)
+    {
+      Slot *chunk = mChunks[aChunk].get();
+
+      for (size_t i = 0; i < tSlotsPerChunk; ++i)
+      {
+        if (chunk[i].mGeneration & 1)
+        {
+          aFunction(reinterpret_cast<tType*>(&chunk[i].mStorage));
+        }
+      }
+    }
+
+  private:
+    struct Slot
+    {
+      typename std::aligned_storage<sizeof(tType), alignof(tType)>::type mStorage;
+      u32 mGeneration;
+      Slot *mNextFree;
+    };
+
+    static Slot* ToSlot(tType const *aObject)
+    {
+      // mStorage is the first member.
+      return reinterpret_cast<Slot*>(const_cast<tType*>(aObject));
+    }
+
+    void AddChunk()
+    {
+      mChunks.emplace_back(std::make_unique<Slot[]>(tSlotsPerChunk));
+      auto chunk = mChunks.back().get();
+
+      // Backwards, so the chunk is handed out front to back.
+      for (size_t i = tSlotsPerChunk; 0 < i--;)
+      {
+        chunk[i].mGeneration = 0;
+        chunk[i].mNextFree = mFree;
+        mFree = &chunk[i];
+      }
+    }
+
+    std::vector<std::unique_ptr<Slot[]>> mChunks;
+    Slot *mFree;
+    size_t mSize;
+  };
+}
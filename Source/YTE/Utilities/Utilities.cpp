@@ -13,7 +13,8 @@ All content (c) 2016 DigiPen  (USA) Corporation, all rights reserved.
 #include <filesystem>
 #include <stdarg.h> /* va_list, va_start, va_end*/
 #include <stdio.h>
-#include <random>
+#include <chrono>
+#include <thread>
 
 #include "YTE/Platform/DialogBox.hpp"
 
@@ -24,25 +25,76 @@ namespace YTE
 {
   std::wstring cWorkingDirectory = std::experimental::filesystem::current_path();
 
-  template <typename tType>
-  tType randomInteger(std::default_random_engine &e)
+  namespace
   {
-    std::uniform_int_distribution<tType> dist{ std::numeric_limits<tType>::min(), std::numeric_limits<tType>::max() };
+    inline u64 SplitMix64(u64 &aState)
+    {
+      u64 result = (aState += 0x9E3779B97F4A7C15ULL);
+      result = (result ^ (result >> 30)) * 0xBF58476D1CE4E5B9ULL;
+      result = (result ^ (result >> 27)) * 0x94D049BB133111EBULL;
+      return result ^ (result >> 31);
+    }
+
+    inline u64 RotateLeft(u64 aValue, int aShift)
+    {
+      return (aValue << aShift) | (aValue >> (64 - aShift));
+    }
+
+    // xoshiro256** (Blackman and Vigna), one per thread. Seeded once from
+    // std::random_device, mixed with the clock and thread in case the
+    // device is deterministic on this platform, so making a GUID is a
+    // handful of shifts and multiplies instead of opening the device.
+    class GUIDGenerator
+    {
+    public:
+      GUIDGenerator()
+      {
+        std::random_device device;
+
+        u64 seed = (static_cast<u64>(device()) << 32) | device();
+        seed ^= static_cast<u64>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+        seed ^= RotateLeft(static_cast<u64>(std::hash<std::thread::id>()(std::this_thread::get_id())), 32);
+
+        for (auto &state : mState)
+        {
+          state = SplitMix64(seed);
+        }
+      }
+
+      u64 operator()()
+      {
+        u64 result = RotateLeft(mState[1] * 5, 7) * 9;
+        u64 t = mState[1] << 17;
+
+        mState[2] ^= mState[0];
+        mState[3] ^= mState[1];
+        mState[1] ^= mState[2];
+        mState[0] ^= mState[3];
+
+        mState[2] ^= t;
+        mState[3] = RotateLeft(mState[3], 45);
 
-    return dist(e);
+        return result;
+      }
+
+    private:
+      u64 mState[4];
+    };
   }
 
   GlobalUniqueIdentifier::GlobalUniqueIdentifier()
   {
-    std::random_device rd;
-    std::mt19937 gen(rd());
+    thread_local GUIDGenerator generator;
+
+    u64 high = generator();
+    u64 low = generator();
 
-    mPart1 = randomInteger<decltype(mPart1)>(gen);
-    mPart2 = randomInteger<decltype(mPart2)>(gen);
-    mVersion = randomInteger<decltype(mVersion)>(gen);
-    mVariant = randomInteger<decltype(mVariant)>(gen);
-    mPart3 = randomInteger<decltype(mPart3)>(gen);
-    mPart4 = randomInteger<decltype(mPart4)>(gen);
+    mPart1 = static_cast<u32>(high >> 32);
+    mPart2 = static_cast<u16>(high >> 16);
+    mVersion = static_cast<u16>(high);
+    mVariant = static_cast<u16>(low >> 48);
+    mPart3 = static_cast<u32>(low >> 16);
+    mPart4 = static_cast<u16>(low);
 
     // Version
     u16 version4Flags = 0b0100000000000000;
@@ -94,7 +146,7 @@ namespace YTE
     return total;
   }
 
-  bool GlobalUniqueIdentifier::operator==(GlobalUniqueIdentifier const& aGUID)
+  bool GlobalUniqueIdentifier::operator==(GlobalUniqueIdentifier const& aGUID) const
   {
     if (this->mPart1 == aGUID.mPart1 &&
         this->mPart2 == aGUID.mPart2 &&
@@ -109,6 +161,11 @@ namespace YTE
     return false;
   }
 
+  bool GlobalUniqueIdentifier::operator!=(GlobalUniqueIdentifier const& aGUID) const
+  {
+    return !(*this == aGUID);
+  }
+
   // Adapted from http://ysonggit.github.io/coding/2014/12/16/split-a-string-using-c.html
   std::vector<std::string> split(const std::string &aString, char aDelimiter, bool aIgnoreEmpty)
   {
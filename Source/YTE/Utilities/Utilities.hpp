@@ -35,8 +35,8 @@ namespace YTE
     YTE_Shared std::string ToString() const;
     YTE_Shared std::string ToIdentifierString() const;
 
-    YTE_Shared bool operator==(GlobalUniqueIdentifier const& aGUID);
-
+    YTE_Shared bool operator==(GlobalUniqueIdentifier const& aGUID) const;
+    YTE_Shared bool operator!=(GlobalUniqueIdentifier const& aGUID) const;
 
     //       u32           u16         u16        u16            u32         u16
     //(xx)(xx)(xx)(xx) - (xx)(xx) - (Mx)(xx) - (Nx)(xx) - (xx)(xx)(xx)(xx)(xx)(xx)
@@ -48,6 +48,31 @@ namespace YTE
     u16 mPart4;
   };
 
+  // Hashes the 128 bits themselves, for keying containers on a GUID without
+  // formatting it with ToString first.
+  struct GlobalUniqueIdentifierHash
+  {
+    size_t operator()(GlobalUniqueIdentifier const& aGUID) const
+    {
+      u64 high = (static_cast<u64>(aGUID.mPart1) << 32) |
+                 (static_cast<u64>(aGUID.mPart2) << 16) |
+                 static_cast<u64>(aGUID.mVersion);
+      u64 low = (static_cast<u64>(aGUID.mVariant) << 48) |
+                (static_cast<u64>(aGUID.mPart3) << 16) |
+                static_cast<u64>(aGUID.mPart4);
+
+      // The version and variant bits are fixed, the rest is random, so
+      // folding the halves together and finishing with a 64-bit mix (the
+      // splitmix64 finalizer) is enough to spread every bit into the result.
+      u64 hash = high ^ (low * 0x9E3779B97F4A7C15ULL);
+      hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+      hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+      hash = hash ^ (hash >> 31);
+
+      return static_cast<size_t>(hash);
+    }
+  };
+
   // Adapted from http://ysonggit.github.io/coding/2014/12/16/split-a-string-using-c.html
   YTE_Shared std::vector<std::string> split(const std::string &aString, char aDelimiter, bool aIgnoreEmpty);
 
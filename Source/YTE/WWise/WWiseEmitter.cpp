@@ -99,7 +99,7 @@ namespace YTE
 
     if (transform != nullptr)
     {
-      mOwner->RegisterEvent<&WWiseEmitter::OnPositionChange>(Events::PositionChanged, this);
+      mOwner->RegisterDeferredEvent<&WWiseEmitter::OnPositionChange>(Events::PositionChanged, this);
       mOwner->RegisterEvent<&WWiseEmitter::OnOrientationChange>(Events::OrientationChanged, this);
       mEmitterPosition.SetPosition(MakeAkVec(transform->GetTranslation()));
 
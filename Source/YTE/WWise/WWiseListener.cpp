@@ -59,7 +59,7 @@ namespace YTE
   {
     auto transform = mOwner->GetComponent<Transform>();
 
-    mOwner->RegisterEvent<&WWiseListener::OnPositionChange>(Events::PositionChanged, this);
+    mOwner->RegisterDeferredEvent<&WWiseListener::OnPositionChange>(Events::PositionChanged, this);
     mOwner->RegisterEvent<&WWiseListener::OnOrientationChange>(Events::OrientationChanged, this);
     mListenerPosition.SetPosition(MakeAkVec(transform->GetTranslation()));
 
@@ -0,0 +1,180 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#include <algorithm>
+#include <cstdio>
+
+#ifdef _WIN32
+  #include "YTE/Platform/Windows/WindowsInclude_Windows.hpp"
+  #include <psapi.h>
+#else
+  #include <sys/resource.h>
+  #include <unistd.h>
+#endif
+
+#include "YTE/Core/Engine.hpp"
+#include "YTE/Core/Threading/JobSystem.hpp"
+
+#include "YTEBenchmarks/Benchmark.hpp"
+
+namespace YTEBenchmarks
+{
+  namespace
+  {
+    void WriteObject(FILE *aFile, size_t aIndex, bool aLast)
+    {
+      float x = static_cast<float>(aIndex % 256);
+      float z = static_cast<float>(aIndex / 256);
+
+      std::fprintf(aFile,
+                   "    \"Object%zu\": {\n"
+                   "      \"Archetype\": \"\",\n"
+                   "      \"Compositions\": {},\n"
+                   "      \"Components\": {\n"
+                   "        \"Transform\": {\n"
+                   "          \"Rotation\": { \"Quaternion\": { \"x\": 0.0, \"y\": 0.0, \"z\": 0.0, \"w\": 1.0 } },\n"
+                   "          \"Scale\": { \"Vector3\": { \"x\": 1.0, \"y\": 1.0, \"z\": 1.0 } },\n"
+                   "          \"Translation\": { \"Vector3\": { \"x\": %.1f, \"y\": 0.0, \"z\": %.1f } }\n"
+                   "        },\n"
+                   "        \"Orientation\": {}\n"
+                   "      }\n"
+                   "    }%s\n",
+                   aIndex,
+                   x,
+                   z,
+                   aLast ? "" : ",");
+    }
+  }
+
+  bool WriteGeneratedLevel(char const *aPath, size_t aObjects, size_t aLoaded)
+  {
+    FILE *file = std::fopen(aPath, "wb");
+
+    if (nullptr == file)
+    {
+      return false;
+    }
+
+    std::fprintf(file, "{\n  \"Archetype\": \"\",\n  \"Compositions\": {\n");
+
+    for (size_t i = 0; i < aLoaded; ++i)
+    {
+      WriteObject(file, i, (i + 1) == aLoaded);
+    }
+
+    std::fprintf(file, "  },\n  \"Unloaded\": {\n");
+
+    for (size_t i = aLoaded; i < aObjects; ++i)
+    {
+      WriteObject(file, i, (i + 1) == aObjects);
+    }
+
+    std::fprintf(file, "  },\n  \"Components\": {}\n}\n");
+    std::fclose(file);
+
+    return true;
+  }
+
+  std::unique_ptr<YTE::JobSystem> MakeJobSystem(YTE::Engine *aEngine, char const *aConfig)
+  {
+    auto jobs = std::make_unique<YTE::JobSystem>(aEngine);
+
+    YTE::RSDocument document;
+    document.Parse(aConfig);
+    jobs->Deserialize(&document);
+    jobs->Initialize();
+
+    return jobs;
+  }
+
+  size_t BackgroundWorkers(YTE::JobSystem *aJobs)
+  {
+    // The main thread's worker is always last.
+    return aJobs->GetTelemetry().mWorkers.size() - 1;
+  }
+
+  double ProcessCpuSeconds()
+  {
+#ifdef _WIN32
+    FILETIME creation, exit, kernel, user;
+    GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user);
+
+    auto seconds = [](FILETIME const &aTime)
+    {
+      ULARGE_INTEGER ticks;
+      ticks.LowPart = aTime.dwLowDateTime;
+      ticks.HighPart = aTime.dwHighDateTime;
+
+      // In 100 nanosecond ticks.
+      return static_cast<double>(ticks.QuadPart) / 10000000.0;
+    };
+
+    return seconds(kernel) + seconds(user);
+#else
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+
+    auto seconds = [](timeval const &aTime)
+    {
+      return static_cast<double>(aTime.tv_sec) + static_cast<double>(aTime.tv_usec) / 1000000.0;
+    };
+
+    return seconds(usage.ru_utime) + seconds(usage.ru_stime);
+#endif
+  }
+
+  size_t ResidentBytes()
+  {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters));
+    return counters.WorkingSetSize;
+#else
+    FILE *file = fopen("/proc/self/statm", "r");
+    unsigned long pages = 0;
+    unsigned long resident = 0;
+
+    if (nullptr != file)
+    {
+      if (2 != fscanf(file, "%lu %lu", &pages, &resident))
+      {
+        resident = 0;
+      }
+
+      fclose(file);
+    }
+
+    return static_cast<size_t>(resident) * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+  }
+
+  size_t PeakResidentBytes()
+  {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters));
+    return counters.PeakWorkingSetSize;
+#else
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+
+    // In kilobytes.
+    return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+  }
+
+  double Percentile(std::vector<double> aSamples, double aPercent)
+  {
+    if (aSamples.empty())
+    {
+      return 0.0;
+    }
+
+    std::sort(aSamples.begin(), aSamples.end());
+    auto index = static_cast<size_t>(aPercent / 100.0 * static_cast<double>(aSamples.size() - 1));
+    return aSamples[index];
+  }
+}
@@ -0,0 +1,105 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#pragma once
+
+#ifndef YTEBenchmarks_Benchmark_hpp
+#define YTEBenchmarks_Benchmark_hpp
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace YTE
+{
+  class Engine;
+  class JobSystem;
+}
+
+namespace YTEBenchmarks
+{
+  // Prints its results, returns false if one of its checks failed. Only
+  // given an Engine if it asked for one.
+  using BenchmarkFunction = bool(*)(YTE::Engine *aEngine);
+
+  struct Benchmark
+  {
+    char const *mName;
+    BenchmarkFunction mFunction;
+    bool mNeedsEngine;
+  };
+
+  using Clock = std::chrono::high_resolution_clock;
+
+  inline double SecondsSince(Clock::time_point aBegin)
+  {
+    return std::chrono::duration<double>(Clock::now() - aBegin).count();
+  }
+
+  // Writes a level of aObjects children named Object0, Object1, ..., each
+  // with a Transform and an Orientation, saved the way the editor saves
+  // levels (Compositions before the root's Components). Only the first
+  // aLoaded are in Compositions, the rest are in a member loading skips, so
+  // the file is the same size however many are loaded.
+  bool WriteGeneratedLevel(char const *aPath, size_t aObjects, size_t aLoaded);
+
+  // A JobSystem owned by aEngine, configured from aConfig (the Engine
+  // config's "JobSystem" object) and initialized.
+  std::unique_ptr<YTE::JobSystem> MakeJobSystem(YTE::Engine *aEngine, char const *aConfig);
+  size_t BackgroundWorkers(YTE::JobSystem *aJobs);
+
+  // User and kernel time of every thread in the process so far.
+  double ProcessCpuSeconds();
+
+  // Memory the process has resident now, and the most it's had so far. The
+  // peak never goes down, so measure whatever should use less first.
+  size_t ResidentBytes();
+  size_t PeakResidentBytes();
+
+  // aPercent of aSamples are at most the result.
+  double Percentile(std::vector<double> aSamples, double aPercent);
+
+  // The work-stealing JobQueue, and against the mutex LockedJobQueue.
+  bool JobQueueStress(YTE::Engine *aEngine);
+  bool JobQueueThroughput(YTE::Engine *aEngine);
+
+  // How long a parked worker takes to start a job, and what idle workers
+  // cost.
+  bool WorkerWakeLatency(YTE::Engine *aEngine);
+  bool WorkerIdleCpu(YTE::Engine *aEngine);
+
+  // Jobs queued and run per second.
+  bool JobThroughput(YTE::Engine *aEngine);
+
+  // Waiting on jobs from inside jobs: deep chains, fork/join, and how soon a
+  // waiter resumes when its worker has a long job queued.
+  bool NestedWaits(YTE::Engine *aEngine);
+
+  // Sending an event to many subscribers, as delegates and as ticks.
+  bool TickDispatch(YTE::Engine *aEngine);
+
+  // Jobs nobody waits on still run in single threaded mode.
+  bool SingleThreadedJobs(YTE::Engine *aEngine);
+
+  // Registering, finding and removing a million compositions by GUID, and
+  // that GUIDs made on several threads at once are all different.
+  bool GUIDRegistry(YTE::Engine *aEngine);
+
+  // Loading a generated 50k object level streamed, and parsed into a
+  // document first as it used to be.
+  bool LevelLoad(YTE::Engine *aEngine);
+
+  // LevelLoader with 0 up to every spare background worker compiling a big
+  // level's children.
+  bool LevelLoadScaling(YTE::Engine *aEngine);
+
+  // LevelLoader attaches children in file order whatever order they're
+  // compiled in, and deserializes any it couldn't compile.
+  bool LevelLoaderOrder(YTE::Engine *aEngine);
+}
+
+#endif
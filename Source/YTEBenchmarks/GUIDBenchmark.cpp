@@ -0,0 +1,148 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "YTE/Core/Composition.hpp"
+#include "YTE/Core/Engine.hpp"
+#include "YTE/Utilities/Utilities.hpp"
+
+#include "YTEBenchmarks/Benchmark.hpp"
+
+namespace YTEBenchmarks
+{
+  namespace
+  {
+    constexpr size_t cObjects = 1000000;
+
+    constexpr size_t cThreads = 4;
+    constexpr size_t cPerThread = 250000;
+
+    // Makes cObjects compositions and registers each with the Engine the
+    // way AssetInitialize does, then looks each one up and removes it.
+    bool Registry(YTE::Engine *aEngine)
+    {
+      std::vector<std::unique_ptr<YTE::Composition>> compositions;
+      compositions.reserve(cObjects);
+      size_t collisions = 0;
+
+      auto begin = Clock::now();
+
+      for (size_t i = 0; i < cObjects; ++i)
+      {
+        auto composition = std::make_unique<YTE::Composition>(aEngine, nullptr);
+
+        while (nullptr != aEngine->StoreCompositionGUID(composition.get()))
+        {
+          composition->GetGUID() = YTE::GlobalUniqueIdentifier();
+          ++collisions;
+        }
+
+        compositions.emplace_back(std::move(composition));
+      }
+
+      double spawn = SecondsSince(begin);
+      size_t found = 0;
+      begin = Clock::now();
+
+      for (auto &composition : compositions)
+      {
+        found += (composition.get() == aEngine->GetCompositionByGUID(composition->GetGUID())) ? 1 : 0;
+      }
+
+      double lookup = SecondsSince(begin);
+      size_t removed = 0;
+      begin = Clock::now();
+
+      for (auto &composition : compositions)
+      {
+        removed += aEngine->RemoveCompositionGUID(composition->GetGUID()) ? 1 : 0;
+      }
+
+      double remove = SecondsSince(begin);
+      compositions.clear();
+
+      std::printf("%zu compositions: spawn %.1f ms, lookup %.1f ms, remove %.1f ms\n",
+                  cObjects,
+                  spawn * 1000.0,
+                  lookup * 1000.0,
+                  remove * 1000.0);
+      std::printf("%zu found, %zu removed, %zu collisions\n", found, removed, collisions);
+
+      return cObjects == found && cObjects == removed && 0 == collisions;
+    }
+
+    // Just making the GUIDs, without a composition around them.
+    void Generate()
+    {
+      size_t checksum = 0;
+      auto begin = Clock::now();
+
+      for (size_t i = 0; i < cObjects; ++i)
+      {
+        YTE::GlobalUniqueIdentifier guid;
+        checksum += guid.mPart1;
+      }
+
+      std::printf("%zu GUIDs generated: %.1f ms (checksum %zu)\n",
+                  cObjects,
+                  SecondsSince(begin) * 1000.0,
+                  checksum);
+    }
+
+    // Each thread has its own generator, they mustn't end up producing the
+    // same values.
+    bool Uniqueness()
+    {
+      std::vector<std::vector<YTE::GlobalUniqueIdentifier>> made(cThreads);
+      std::vector<std::thread> threads;
+
+      for (auto &guids : made)
+      {
+        threads.emplace_back([&guids]()
+        {
+          guids.reserve(cPerThread);
+
+          for (size_t i = 0; i < cPerThread; ++i)
+          {
+            guids.emplace_back();
+          }
+        });
+      }
+
+      for (auto &thread : threads)
+      {
+        thread.join();
+      }
+
+      std::unordered_set<YTE::GlobalUniqueIdentifier, YTE::GlobalUniqueIdentifierHash> unique;
+      unique.reserve(cThreads * cPerThread);
+
+      for (auto &guids : made)
+      {
+        unique.insert(guids.begin(), guids.end());
+      }
+
+      std::printf("%zu threads x %zu GUIDs: %zu unique\n", cThreads, cPerThread, unique.size());
+
+      return (cThreads * cPerThread) == unique.size();
+    }
+  }
+
+  bool GUIDRegistry(YTE::Engine *aEngine)
+  {
+    Generate();
+
+    bool passed = Registry(aEngine);
+    passed = Uniqueness() && passed;
+
+    return passed;
+  }
+}
@@ -0,0 +1,254 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "YTE/Core/Threading/JobQueue.hpp"
+#include "YTE/Core/Threading/LockedJobQueue.hpp"
+
+#include "YTEBenchmarks/Benchmark.hpp"
+
+namespace YTEBenchmarks
+{
+  namespace
+  {
+    // The queues only store the pointers, so any distinct non-null value
+    // stands in for a job.
+    YTE::Job* FakeJob(size_t aValue)
+    {
+      return reinterpret_cast<YTE::Job*>(static_cast<std::uintptr_t>(aValue + 1));
+    }
+
+    size_t FakeValue(YTE::Job *aJob)
+    {
+      return static_cast<size_t>(reinterpret_cast<std::uintptr_t>(aJob) - 1);
+    }
+
+    // The owner pushes and pops its end, thieves take from the other. The
+    // mutex queue has one end for everyone, which is how the old JobQueue
+    // behaved too.
+    struct ChaseLevQueue
+    {
+      static constexpr char const *cName = "JobQueue";
+
+      void Push(YTE::Job *aJob) { mQueue.Push(aJob); }
+      YTE::Job* Pop() { return mQueue.Pop(); }
+      YTE::Job* Steal() { return mQueue.Steal(); }
+
+      YTE::JobQueue mQueue;
+    };
+
+    struct MutexQueue
+    {
+      static constexpr char const *cName = "LockedJobQueue";
+
+      void Push(YTE::Job *aJob) { mQueue.Push(aJob); }
+      YTE::Job* Pop() { return mQueue.Pop(); }
+      YTE::Job* Steal() { return mQueue.Pop(); }
+
+      YTE::LockedJobQueue mQueue;
+    };
+
+    size_t MaxWorkers()
+    {
+      return std::max<size_t>(std::thread::hardware_concurrency(), 2);
+    }
+
+    // Frame level fan-out: one worker pushes every job in bursts and works
+    // through its own queue, the others do nothing but steal from it.
+    // Returns millions of jobs per second.
+    template <typename tQueue>
+    double FanOut(size_t aWorkers, size_t aJobs, bool &aLostJobs)
+    {
+      constexpr size_t cBurst = 1024;
+
+      tQueue queue;
+      std::atomic<bool> start{ false };
+      std::atomic<bool> done{ false };
+      std::atomic<size_t> taken{ 0 };
+      std::vector<std::thread> thieves;
+
+      for (size_t i = 1; i < aWorkers; ++i)
+      {
+        thieves.emplace_back([&queue, &start, &done, &taken]()
+        {
+          while (false == start.load(std::memory_order_acquire))
+          {
+            std::this_thread::yield();
+          }
+
+          size_t stolen = 0;
+
+          while (false == done.load(std::memory_order_acquire))
+          {
+            if (queue.Steal())
+            {
+              ++stolen;
+            }
+          }
+
+          taken.fetch_add(stolen, std::memory_order_relaxed);
+        });
+      }
+
+      auto begin = Clock::now();
+      start.store(true, std::memory_order_release);
+
+      size_t popped = 0;
+
+      for (size_t pushed = 0; pushed < aJobs; )
+      {
+        for (size_t i = 0; i < cBurst && pushed < aJobs; ++i, ++pushed)
+        {
+          queue.Push(FakeJob(pushed));
+        }
+
+        while (queue.Pop())
+        {
+          ++popped;
+        }
+      }
+
+      // Anything stolen is already out of the queue, so once the owner finds
+      // it empty there's nothing left to run.
+      double seconds = SecondsSince(begin);
+      done.store(true, std::memory_order_release);
+
+      for (auto &thief : thieves)
+      {
+        thief.join();
+      }
+
+      aLostJobs = aLostJobs || (aJobs != popped + taken.load());
+
+      return static_cast<double>(aJobs) / seconds / 1000000.0;
+    }
+
+    template <typename tQueue>
+    double BestFanOut(size_t aWorkers, size_t aJobs, bool &aLostJobs)
+    {
+      double best = 0.0;
+
+      for (size_t run = 0; run < 3; ++run)
+      {
+        best = std::max(best, FanOut<tQueue>(aWorkers, aJobs, aLostJobs));
+      }
+
+      return best;
+    }
+  }
+
+  // The owner pushes (forcing the buffer to grow from 2) while popping every
+  // third time, with every other thread stealing. Every job must come out
+  // exactly once.
+  bool JobQueueStress(YTE::Engine *aEngine)
+  {
+    YTE::UnusedArguments(aEngine);
+
+    constexpr size_t cJobs = 1 << 22;
+    size_t thiefCount = MaxWorkers() - 1;
+
+    YTE::JobQueue queue{ 2 };
+    std::unique_ptr<std::atomic<unsigned>[]> taken{ new std::atomic<unsigned>[cJobs]() };
+    std::atomic<bool> done{ false };
+    std::vector<std::thread> thieves;
+
+    auto take = [&taken](YTE::Job *aJob)
+    {
+      taken[FakeValue(aJob)].fetch_add(1, std::memory_order_relaxed);
+    };
+
+    for (size_t i = 0; i < thiefCount; ++i)
+    {
+      thieves.emplace_back([&queue, &done, &take]()
+      {
+        while (false == done.load(std::memory_order_acquire))
+        {
+          if (auto job = queue.Steal())
+          {
+            take(job);
+          }
+        }
+      });
+    }
+
+    for (size_t i = 0; i < cJobs; ++i)
+    {
+      queue.Push(FakeJob(i));
+
+      if (0 == (i % 3))
+      {
+        if (auto job = queue.Pop())
+        {
+          take(job);
+        }
+      }
+    }
+
+    while (auto job = queue.Pop())
+    {
+      take(job);
+    }
+
+    done.store(true, std::memory_order_release);
+
+    for (auto &thief : thieves)
+    {
+      thief.join();
+    }
+
+    size_t lost = 0;
+    size_t duplicated = 0;
+
+    for (size_t i = 0; i < cJobs; ++i)
+    {
+      auto count = taken[i].load();
+      lost += (0 == count) ? 1 : 0;
+      duplicated += (1 < count) ? 1 : 0;
+    }
+
+    std::printf("%zu jobs, %zu thieves: %zu lost, %zu taken more than once, %zu left\n",
+                cJobs,
+                thiefCount,
+                lost,
+                duplicated,
+                queue.Size());
+
+    return 0 == lost && 0 == duplicated && 0 == queue.Size();
+  }
+
+  bool JobQueueThroughput(YTE::Engine *aEngine)
+  {
+    YTE::UnusedArguments(aEngine);
+
+    constexpr size_t cJobs = 1 << 21;
+    bool lostJobs = false;
+
+    std::printf("%zu jobs fanned out from one worker, millions of jobs per second (best of 3)\n", cJobs);
+    std::printf("%8s %16s %16s\n", "workers", MutexQueue::cName, ChaseLevQueue::cName);
+
+    for (size_t workers = 1; workers <= MaxWorkers(); ++workers)
+    {
+      double locked = BestFanOut<MutexQueue>(workers, cJobs, lostJobs);
+      double chaseLev = BestFanOut<ChaseLevQueue>(workers, cJobs, lostJobs);
+
+      std::printf("%8zu %16.2f %16.2f\n", workers, locked, chaseLev);
+    }
+
+    if (lostJobs)
+    {
+      std::printf("jobs went missing\n");
+    }
+
+    return false == lostJobs;
+  }
+}
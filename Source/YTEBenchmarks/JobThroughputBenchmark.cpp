@@ -0,0 +1,133 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+
+#include "YTE/Core/Threading/JobSystem.hpp"
+
+#include "YTEBenchmarks/Benchmark.hpp"
+
+namespace YTEBenchmarks
+{
+  namespace
+  {
+    constexpr size_t cJobs = 1 << 18;
+
+    // A job queues cJobs empty children and we wait for all of them, so this
+    // is the cost of making, queueing, running and freeing a job. Returns
+    // millions of jobs per second, best of 3.
+    template <typename tMakeChild>
+    double FanOut(YTE::JobSystem *aJobs, tMakeChild aMakeChild, bool &aMissed)
+    {
+      double best = 0.0;
+
+      for (size_t run = 0; run < 3; ++run)
+      {
+        std::atomic<size_t> ran{ 0 };
+        auto begin = Clock::now();
+
+        auto root = aJobs->QueueJobThisThread([aJobs, &aMakeChild, &ran](YTE::JobHandle &aHandle)
+        {
+          for (size_t i = 0; i < cJobs; ++i)
+          {
+            aMakeChild(aJobs, aHandle, ran);
+          }
+        });
+
+        aJobs->WaitThisThread(root);
+
+        double seconds = SecondsSince(begin);
+        best = std::max(best, static_cast<double>(cJobs) / seconds / 1000000.0);
+        aMissed = aMissed || (cJobs != ran.load());
+      }
+
+      return best;
+    }
+
+    void VoidChild(YTE::JobSystem *aJobs, YTE::JobHandle &aParent, std::atomic<size_t> &aRan)
+    {
+      aJobs->QueueJobThisThread([&aRan](YTE::JobHandle&)
+      {
+        aRan.fetch_add(1, std::memory_order_relaxed);
+      }, aParent);
+    }
+
+    // Goes through the Any, which void jobs skip.
+    void ReturningChild(YTE::JobSystem *aJobs, YTE::JobHandle &aParent, std::atomic<size_t> &aRan)
+    {
+      aJobs->QueueJobThisThread([&aRan](YTE::JobHandle&)
+      {
+        return aRan.fetch_add(1, std::memory_order_relaxed);
+      }, aParent);
+    }
+
+    // ParallelFor with a grain of 1 splits into about two jobs per index.
+    // Single threaded it runs as a plain loop instead.
+    double ParallelForOnes(YTE::JobSystem *aJobs, bool &aMissed)
+    {
+      double best = 0.0;
+
+      for (size_t run = 0; run < 3; ++run)
+      {
+        std::atomic<size_t> ran{ 0 };
+        auto begin = Clock::now();
+
+        auto root = aJobs->QueueJobThisThread([aJobs, &ran](YTE::JobHandle&)
+        {
+          aJobs->ParallelFor(0, cJobs, 1, [&ran](size_t)
+          {
+            ran.fetch_add(1, std::memory_order_relaxed);
+          });
+        });
+
+        aJobs->WaitThisThread(root);
+
+        double seconds = SecondsSince(begin);
+        best = std::max(best, static_cast<double>(cJobs) / seconds / 1000000.0);
+        aMissed = aMissed || (cJobs != ran.load());
+      }
+
+      return best;
+    }
+
+    bool Measure(YTE::Engine *aEngine, char const *aName, char const *aConfig)
+    {
+      bool missed = false;
+      auto jobs = MakeJobSystem(aEngine, aConfig);
+
+      double voidJobs = FanOut(jobs.get(), &VoidChild, missed);
+      double returningJobs = FanOut(jobs.get(), &ReturningChild, missed);
+      double parallelFor = ParallelForOnes(jobs.get(), missed);
+
+      std::printf("%-16s %8zu %12.2f %12.2f %12.2f\n",
+                  aName,
+                  BackgroundWorkers(jobs.get()),
+                  voidJobs,
+                  returningJobs,
+                  parallelFor);
+
+      return false == missed;
+    }
+  }
+
+  bool JobThroughput(YTE::Engine *aEngine)
+  {
+    std::printf("%zu empty jobs queued from a job, millions of jobs per second (best of 3)\n", cJobs);
+    std::printf("%-16s %8s %12s %12s %12s\n", "", "workers", "void", "returning", "ParallelFor");
+
+    bool passed = Measure(aEngine, "single threaded", "{ \"SingleThreaded\": true }");
+    passed = Measure(aEngine, "default", "{ \"IOThreads\": 0 }") && passed;
+
+    if (false == passed)
+    {
+      std::printf("not every job ran\n");
+    }
+
+    return passed;
+  }
+}
@@ -0,0 +1,192 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "rapidjson/filereadstream.h"
+#include "rapidjson/reader.h"
+
+#include "YTE/Core/Engine.hpp"
+#include "YTE/Core/LevelLoader.hpp"
+#include "YTE/Core/Space.hpp"
+#include "YTE/Utilities/Utilities.hpp"
+
+#include "YTEBenchmarks/Benchmark.hpp"
+
+namespace YTEBenchmarks
+{
+  namespace
+  {
+    constexpr size_t cObjects = 50000;
+
+    // LevelLoader adds children this many at a time.
+    constexpr size_t cFirstBatch = 256;
+
+    char const *cLevelPath = "GeneratedLevel.json";
+    char const *cFirstBatchPath = "GeneratedLevelFirstBatch.json";
+
+    // Just reading the file, what LevelLoader's first pass costs on top of
+    // the second.
+    double ScanSeconds(char const *aPath)
+    {
+      FILE *file = std::fopen(aPath, "rb");
+
+      if (nullptr == file)
+      {
+        return 0.0;
+      }
+
+      auto begin = Clock::now();
+
+      std::vector<char> buffer(64 * 1024);
+      rapidjson::FileReadStream stream(file, buffer.data(), buffer.size());
+      rapidjson::BaseReaderHandler<> handler;
+      rapidjson::Reader reader;
+      reader.Parse(stream, handler);
+
+      double seconds = SecondsSince(begin);
+      std::fclose(file);
+
+      return seconds;
+    }
+
+    struct LoadResult
+    {
+      double mFirstObject = 0.0;
+      double mTotal = 0.0;
+      size_t mPeakBytes = 0;
+      size_t mObjects = 0;
+    };
+
+    double Megabytes(size_t aBytes)
+    {
+      return static_cast<double>(aBytes) / (1024.0 * 1024.0);
+    }
+
+    // How far the process's peak is above aBaseline. Memory freed by an
+    // earlier load is often kept by the heap and reused, so this is only
+    // right for a load that sets a new peak.
+    size_t PeakAbove(size_t aBaseline)
+    {
+      size_t peak = PeakResidentBytes();
+      return (peak > aBaseline) ? (peak - aBaseline) : 0;
+    }
+
+    LoadResult Streamed(YTE::Engine *aEngine, size_t aBaseline)
+    {
+      LoadResult result;
+
+      {
+        auto space = std::make_unique<YTE::Space>(aEngine, nullptr);
+        auto begin = Clock::now();
+
+        YTE::LevelLoader loader{ space.get() };
+        loader.LoadFile(cFirstBatchPath, "GeneratedLevelFirstBatch");
+
+        result.mFirstObject = SecondsSince(begin);
+      }
+
+      auto space = std::make_unique<YTE::Space>(aEngine, nullptr);
+      auto begin = Clock::now();
+
+      YTE::LevelLoader loader{ space.get() };
+      loader.LoadFile(cLevelPath, "GeneratedLevel");
+
+      result.mTotal = SecondsSince(begin);
+      result.mPeakBytes = PeakAbove(aBaseline);
+      result.mObjects = space->GetCompositions().size();
+
+      return result;
+    }
+
+    // What Engine::GetLevel and Space::Load used to do: read the file into a
+    // string, parse all of it into a document, then walk that.
+    LoadResult Document(YTE::Engine *aEngine, size_t aBaseline)
+    {
+      LoadResult result;
+
+      auto space = std::make_unique<YTE::Space>(aEngine, nullptr);
+      auto begin = Clock::now();
+
+      {
+        std::string text;
+        YTE::ReadFileToString(cLevelPath, text);
+
+        YTE::RSDocument document;
+        document.Parse(text.c_str());
+
+        // Nothing exists until the whole file is parsed.
+        result.mFirstObject = SecondsSince(begin);
+
+        space->Deserialize(&document);
+      }
+
+      result.mTotal = SecondsSince(begin);
+      result.mPeakBytes = PeakAbove(aBaseline);
+      result.mObjects = space->GetCompositions().size();
+
+      return result;
+    }
+
+    void Print(char const *aName, LoadResult const &aResult)
+    {
+      std::printf("%-10s %12.1f %10.1f %14.1f %10zu\n",
+                  aName,
+                  aResult.mFirstObject * 1000.0,
+                  aResult.mTotal * 1000.0,
+                  Megabytes(aResult.mPeakBytes),
+                  aResult.mObjects);
+    }
+  }
+
+  bool LevelLoad(YTE::Engine *aEngine)
+  {
+    if (false == WriteGeneratedLevel(cLevelPath, cObjects, cObjects) ||
+        false == WriteGeneratedLevel(cFirstBatchPath, cObjects, cFirstBatch))
+    {
+      std::printf("couldn't write the generated levels\n");
+      return false;
+    }
+
+    FILE *file = std::fopen(cLevelPath, "rb");
+    std::fseek(file, 0, SEEK_END);
+    long fileBytes = std::ftell(file);
+    std::fclose(file);
+
+    std::printf("%zu objects, %.1f MB of JSON\n", cObjects, Megabytes(static_cast<size_t>(fileBytes)));
+    std::printf("%-10s %12s %10s %14s %10s\n", "", "first ms", "total ms", "peak MB", "objects");
+
+    // The streamed load first, it should peak lower. Peaks are counted from
+    // what was resident before either load.
+    size_t baseline = ResidentBytes();
+
+    auto streamed = Streamed(aEngine, baseline);
+    Print("streamed", streamed);
+
+    double scan = ScanSeconds(cLevelPath);
+    auto document = Document(aEngine, baseline);
+    Print("document", document);
+
+    if (document.mPeakBytes <= streamed.mPeakBytes)
+    {
+      std::printf("the document load didn't set a new peak, its peak is at most the streamed one\n");
+    }
+
+    // The streamed load reads the file twice, this is what the extra read
+    // costs next to the load as a whole.
+    std::printf("reading the file once more: %.1f ms, %.1f%% of the streamed load\n",
+                scan * 1000.0,
+                (streamed.mTotal > 0.0) ? (100.0 * scan / streamed.mTotal) : 0.0);
+
+    std::remove(cLevelPath);
+    std::remove(cFirstBatchPath);
+
+    return cObjects == streamed.mObjects && cObjects == document.mObjects;
+  }
+}
@@ -0,0 +1,112 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "YTE/Core/Engine.hpp"
+#include "YTE/Core/LevelLoader.hpp"
+#include "YTE/Core/Space.hpp"
+#include "YTE/Core/Threading/JobSystem.hpp"
+
+#include "YTEBenchmarks/Benchmark.hpp"
+
+namespace YTEBenchmarks
+{
+  namespace
+  {
+    constexpr size_t cObjects = 20000;
+
+    char const *cLevelPath = "GeneratedScalingLevel.json";
+
+    // 0, 1, 2, 4, ... and however many the machine has to spare.
+    std::vector<size_t> WorkerCounts()
+    {
+      size_t hardware = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+      std::vector<size_t> counts{ 0 };
+
+      for (size_t workers = 1; workers < hardware; workers *= 2)
+      {
+        counts.push_back(workers);
+      }
+
+      if (counts.back() != (hardware - 1))
+      {
+        counts.push_back(hardware - 1);
+      }
+
+      return counts;
+    }
+
+    // Best of 3 loads of the level, in seconds.
+    double Load(YTE::Engine *aEngine, YTE::JobSystem *aJobs, size_t &aObjects)
+    {
+      double best = 0.0;
+
+      for (size_t run = 0; run < 3; ++run)
+      {
+        auto space = std::make_unique<YTE::Space>(aEngine, nullptr);
+        auto begin = Clock::now();
+
+        YTE::LevelLoader loader{ space.get(), aJobs };
+        loader.LoadFile(cLevelPath, "GeneratedScalingLevel");
+
+        double seconds = SecondsSince(begin);
+        best = (0 == run) ? seconds : std::min(best, seconds);
+        aObjects = space->GetCompositions().size();
+      }
+
+      return best;
+    }
+  }
+
+  bool LevelLoadScaling(YTE::Engine *aEngine)
+  {
+    if (false == WriteGeneratedLevel(cLevelPath, cObjects, cObjects))
+    {
+      std::printf("couldn't write the generated level\n");
+      return false;
+    }
+
+    std::printf("loading %zu children, best of 3. Only compiling them runs on the workers,\n"
+                "making and attaching them stays on this thread.\n",
+                cObjects);
+    std::printf("%8s %10s %8s\n", "workers", "ms", "speedup");
+
+    bool passed = true;
+    double serial = 0.0;
+
+    for (auto workers : WorkerCounts())
+    {
+      std::string config = "{ \"Workers\": " + std::to_string(workers) + ", \"IOThreads\": 0 }";
+      auto jobs = MakeJobSystem(aEngine, config.c_str());
+
+      size_t objects = 0;
+      double seconds = Load(aEngine, jobs.get(), objects);
+
+      if (0 == workers)
+      {
+        serial = seconds;
+      }
+
+      std::printf("%8zu %10.1f %8.2f\n", workers, seconds * 1000.0, serial / seconds);
+
+      if (cObjects != objects)
+      {
+        std::printf("only %zu of %zu children were loaded\n", objects, cObjects);
+        passed = false;
+      }
+    }
+
+    std::remove(cLevelPath);
+
+    return passed;
+  }
+}
@@ -0,0 +1,119 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include "YTE/Core/Engine.hpp"
+#include "YTE/Core/LevelLoader.hpp"
+#include "YTE/Core/Space.hpp"
+#include "YTE/Core/Threading/JobSystem.hpp"
+#include "YTE/Physics/Transform.hpp"
+
+#include "YTEBenchmarks/Benchmark.hpp"
+
+namespace YTEBenchmarks
+{
+  namespace
+  {
+    // More than two of LevelLoader's batches of 256.
+    constexpr size_t cChildren = 600;
+
+    // Its child has no Components, so it can't be compiled into a Blueprint
+    // and is added with Composition::DeserializeChild instead.
+    constexpr size_t cInvalidChild = 300;
+
+    char const *cLevelPath = "LevelLoaderOrder.json";
+
+    // Each child's Translation.x is its index, so a child compiled in
+    // parallel but attached out of order, or given another child's
+    // properties, is caught.
+    bool WriteLevel()
+    {
+      FILE *file = std::fopen(cLevelPath, "wb");
+
+      if (nullptr == file)
+      {
+        return false;
+      }
+
+      std::fprintf(file, "{ \"Archetype\": \"\", \"Compositions\": {\n");
+
+      for (size_t i = 0; i < cChildren; ++i)
+      {
+        char const *children = (cInvalidChild == i) ? "{ \"Broken\": { \"Archetype\": \"\", \"Compositions\": {} } }"
+                                                    : "{}";
+
+        std::fprintf(file,
+                     "  \"Object%zu\": { \"Archetype\": \"\", \"Compositions\": %s, "
+                     "\"Components\": { \"Transform\": { \"Translation\": { \"Vector3\": "
+                     "{ \"x\": %zu.0, \"y\": 0.0, \"z\": 0.0 } } } } }%s\n",
+                     i,
+                     children,
+                     i,
+                     ((i + 1) == cChildren) ? "" : ",");
+      }
+
+      std::fprintf(file, "}, \"Components\": {} }\n");
+      std::fclose(file);
+
+      return true;
+    }
+  }
+
+  // Debug Windows builds raise Composition::Deserialize's objection about
+  // the invalid child, continue past it.
+  bool LevelLoaderOrder(YTE::Engine *aEngine)
+  {
+    if (false == WriteLevel())
+    {
+      std::printf("couldn't write the level\n");
+      return false;
+    }
+
+    auto jobs = MakeJobSystem(aEngine, "{ \"IOThreads\": 0 }");
+    auto space = std::make_unique<YTE::Space>(aEngine, nullptr);
+
+    YTE::LevelLoader loader{ space.get(), jobs.get() };
+    bool loaded = loader.LoadFile(cLevelPath, "LevelLoaderOrder");
+    std::remove(cLevelPath);
+
+    size_t index = 0;
+    size_t inOrder = 0;
+    bool fellBack = false;
+
+    for (auto const&[name, composition] : space->GetCompositions())
+    {
+      auto transform = composition->GetComponent<YTE::Transform>();
+      std::string expected = "Object" + std::to_string(index);
+
+      if (expected == name.c_str() &&
+          nullptr != transform &&
+          static_cast<float>(index) == transform->GetTranslation().x)
+      {
+        ++inOrder;
+      }
+
+      if (cInvalidChild == index)
+      {
+        auto &children = composition->GetCompositions();
+        fellBack = (1 == children.size()) && (children.begin()->first == "Broken");
+      }
+
+      ++index;
+    }
+
+    std::printf("%zu background workers, %zu of %zu children attached in file order\n",
+                BackgroundWorkers(jobs.get()),
+                inOrder,
+                cChildren);
+    std::printf("the child that couldn't be compiled was %s\n",
+                fellBack ? "deserialized in its place" : "missing or wrong");
+
+    return loaded && cChildren == index && cChildren == inOrder && fellBack;
+  }
+}
@@ -0,0 +1,192 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "YTE/Core/Threading/JobSystem.hpp"
+
+#include "YTEBenchmarks/Benchmark.hpp"
+
+namespace YTEBenchmarks
+{
+  namespace
+  {
+    // Fib(20) queues a job and waits on it for every n >= 2.
+    constexpr int cFib = 20;
+    constexpr long cFibResult = 6765;
+    constexpr size_t cFibWaits = 10945;
+
+    constexpr size_t cResumeRuns = 100;
+
+    void Spin(double aSeconds)
+    {
+      auto begin = Clock::now();
+
+      while (SecondsSince(begin) < aSeconds)
+      {
+      }
+    }
+
+    // Every level queues the next and waits on it from inside a job, so
+    // aDepth fibers end up suspended at once.
+    void Chain(YTE::JobSystem *aJobs, size_t aDepth)
+    {
+      if (0 == aDepth)
+      {
+        return;
+      }
+
+      auto next = aJobs->QueueJobThisThread([aJobs, aDepth](YTE::JobHandle&)
+      {
+        Chain(aJobs, aDepth - 1);
+      });
+
+      aJobs->WaitThisThread(next);
+    }
+
+    long Fib(YTE::JobSystem *aJobs, int aN)
+    {
+      if (aN < 2)
+      {
+        return aN;
+      }
+
+      long first = 0;
+
+      auto job = aJobs->QueueJobThisThread([aJobs, aN, &first](YTE::JobHandle&)
+      {
+        first = Fib(aJobs, aN - 1);
+      });
+
+      long second = Fib(aJobs, aN - 2);
+      aJobs->WaitThisThread(job);
+
+      return first + second;
+    }
+
+    // A job waits on a dependency that another worker is running, after
+    // queueing a 20ms job of its own. The waiter should be picked back up
+    // when the dependency finishes, not once its worker is done with the
+    // long job. Returns microseconds from the dependency finishing to the
+    // waiter running again, one per run.
+    std::vector<double> ResumeBehindLongJob(YTE::JobSystem *aJobs)
+    {
+      std::vector<double> latencies;
+
+      for (size_t run = 0; run < cResumeRuns; ++run)
+      {
+        std::atomic<bool> started{ false };
+        Clock::time_point finished;
+        Clock::time_point resumed;
+
+        auto waiter = aJobs->QueueJobThisThread([aJobs, &started, &finished, &resumed](YTE::JobHandle&)
+        {
+          auto dependency = aJobs->QueueJobThisThread([&started, &finished](YTE::JobHandle&)
+          {
+            started = true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            finished = Clock::now();
+          });
+
+          // Only queue the long job once the dependency is running elsewhere,
+          // otherwise we'd just run the dependency ourselves.
+          while (false == started)
+          {
+            std::this_thread::yield();
+          }
+
+          aJobs->QueueJobThisThread([](YTE::JobHandle&)
+          {
+            Spin(0.020);
+          });
+
+          aJobs->WaitThisThread(dependency);
+          resumed = Clock::now();
+        });
+
+        aJobs->WaitThisThread(waiter);
+        latencies.push_back(std::chrono::duration<double, std::micro>(resumed - finished).count());
+
+        // Let the long job finish before the next run.
+        std::this_thread::sleep_for(std::chrono::milliseconds(25));
+      }
+
+      return latencies;
+    }
+  }
+
+  bool NestedWaits(YTE::Engine *aEngine)
+  {
+    auto jobs = MakeJobSystem(aEngine, "{ \"IOThreads\": 0 }");
+    bool passed = true;
+
+    std::printf("%zu background workers\n", BackgroundWorkers(jobs.get()));
+
+    for (size_t depth : { 64, 512 })
+    {
+      auto begin = Clock::now();
+
+      auto root = jobs->QueueJobThisThread([&jobs, depth](YTE::JobHandle&)
+      {
+        Chain(jobs.get(), depth);
+      });
+
+      jobs->WaitThisThread(root);
+
+      std::printf("chain of %zu nested waits: %.2f us per wait\n",
+                  depth,
+                  SecondsSince(begin) * 1000000.0 / static_cast<double>(depth));
+    }
+
+    for (size_t run = 0; run < 3; ++run)
+    {
+      long result = 0;
+      auto begin = Clock::now();
+
+      auto root = jobs->QueueJobThisThread([&jobs, &result](YTE::JobHandle&)
+      {
+        result = Fib(jobs.get(), cFib);
+      });
+
+      jobs->WaitThisThread(root);
+
+      std::printf("fork/join fib(%d), %zu waits: %.2f ms\n", cFib, cFibWaits, SecondsSince(begin) * 1000.0);
+      passed = passed && (cFibResult == result);
+    }
+
+    // The waiter spins until another worker has started its dependency.
+    if (BackgroundWorkers(jobs.get()) < 2)
+    {
+      std::printf("resume behind a long job: skipped, needs 2 background workers\n");
+      return passed;
+    }
+
+    auto latencies = ResumeBehindLongJob(jobs.get());
+    size_t late = 0;
+
+    for (auto latency : latencies)
+    {
+      late += (latency > 1000.0) ? 1 : 0;
+    }
+
+    std::printf("resume behind a 20ms job: median %.1f us, max %.1f us, %zu of %zu over 1ms\n",
+                Percentile(latencies, 50.0),
+                Percentile(latencies, 100.0),
+                late,
+                latencies.size());
+
+    if (false == passed)
+    {
+      std::printf("fork/join gave the wrong result\n");
+    }
+
+    return passed;
+  }
+}
@@ -0,0 +1,78 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "YTE/Core/Engine.hpp"
+#include "YTE/Core/Threading/JobSystem.hpp"
+
+#include "YTEBenchmarks/Benchmark.hpp"
+
+namespace YTEBenchmarks
+{
+  // With "SingleThreaded" there are no background workers, so jobs only run
+  // when the main thread gets to them. None of these are ever waited on, by
+  // the end of a frame each must still have run, on the main thread.
+  bool SingleThreadedJobs(YTE::Engine *aEngine)
+  {
+    auto jobs = MakeJobSystem(aEngine, "{ \"SingleThreaded\": true }");
+    auto mainThread = std::this_thread::get_id();
+
+    std::vector<char const*> ran;
+    bool offMainThread = false;
+
+    auto record = [&ran, &offMainThread, mainThread](char const *aName)
+    {
+      offMainThread = offMainThread || (mainThread != std::this_thread::get_id());
+      ran.push_back(aName);
+    };
+
+    jobs->QueueJobThisThread([&record](YTE::JobHandle&)
+    {
+      record("queued");
+    });
+
+    jobs->QueueJobThisThread([&jobs, &record](YTE::JobHandle&)
+    {
+      jobs->QueueJobThisThread([&record](YTE::JobHandle&)
+      {
+        record("queued by a job");
+      });
+    });
+
+    auto first = jobs->QueueJobThisThread([](YTE::JobHandle&)
+    {
+      return 1;
+    });
+
+    jobs->Then(first, [&record](YTE::JobHandle&)
+    {
+      record("continuation");
+    });
+
+    YTE::LogicUpdate update;
+    update.Dt = 0.016;
+    jobs->Update(&update);
+
+    char const *expected[] = { "queued", "queued by a job", "continuation" };
+    bool passed = (ran.size() == (sizeof(expected) / sizeof(expected[0])));
+
+    for (size_t i = 0; passed && i < ran.size(); ++i)
+    {
+      passed = (0 == std::strcmp(ran[i], expected[i]));
+    }
+
+    std::printf("%zu background workers, %zu of 3 jobs ran in order%s\n",
+                BackgroundWorkers(jobs.get()),
+                passed ? ran.size() : 0,
+                offMainThread ? ", some off the main thread" : "");
+
+    return passed && false == offMainThread && 0 == BackgroundWorkers(jobs.get());
+  }
+}
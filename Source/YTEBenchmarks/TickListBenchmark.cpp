@@ -0,0 +1,161 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "YTE/Core/Engine.hpp"
+#include "YTE/Core/EventHandler.hpp"
+
+#include "YTEBenchmarks/Benchmark.hpp"
+
+namespace YTEBenchmarks
+{
+  namespace
+  {
+    constexpr size_t cSubscribers = 100000;
+    constexpr size_t cSends = 100;
+
+    // Stands in for a component: separately allocated, a little state to
+    // touch, several types each with their own update.
+    template <int tType>
+    class Subscriber : public YTE::EventHandler
+    {
+    public:
+      void Update(YTE::LogicUpdate *aEvent)
+      {
+        mTime += aEvent->Dt;
+        ++mUpdates;
+      }
+
+      double mTime = 0.0;
+      size_t mUpdates = 0;
+    };
+
+    struct Subscribers
+    {
+      template <int tType>
+      void Make(std::vector<std::unique_ptr<Subscriber<tType>>> &aList)
+      {
+        aList.push_back(std::make_unique<Subscriber<tType>>());
+      }
+
+      template <typename tFunction>
+      void ForEach(tFunction &&aFunction)
+      {
+        ForEachIn(mType0, aFunction);
+        ForEachIn(mType1, aFunction);
+        ForEachIn(mType2, aFunction);
+        ForEachIn(mType3, aFunction);
+      }
+
+      template <typename tList, typename tFunction>
+      static void ForEachIn(tList &aList, tFunction &aFunction)
+      {
+        for (auto &subscriber : aList)
+        {
+          aFunction(subscriber.get());
+        }
+      }
+
+      std::vector<std::unique_ptr<Subscriber<0>>> mType0;
+      std::vector<std::unique_ptr<Subscriber<1>>> mType1;
+      std::vector<std::unique_ptr<Subscriber<2>>> mType2;
+      std::vector<std::unique_ptr<Subscriber<3>>> mType3;
+    };
+
+    // Made in the order components usually are, a few of each type per
+    // object, rather than every one of a type together.
+    void MakeSubscribers(Subscribers &aSubscribers)
+    {
+      for (size_t i = 0; i < cSubscribers / 4; ++i)
+      {
+        aSubscribers.Make(aSubscribers.mType0);
+        aSubscribers.Make(aSubscribers.mType1);
+        aSubscribers.Make(aSubscribers.mType2);
+        aSubscribers.Make(aSubscribers.mType3);
+      }
+    }
+
+    // Microseconds per send, best of cSends.
+    double Send(YTE::EventHandler &aSource)
+    {
+      YTE::LogicUpdate update;
+      update.Dt = 0.016;
+
+      double best = 1e30;
+
+      for (size_t i = 0; i < cSends; ++i)
+      {
+        auto begin = Clock::now();
+        aSource.SendEvent(YTE::Events::LogicUpdate, &update);
+        best = std::min(best, SecondsSince(begin) * 1000000.0);
+      }
+
+      return best;
+    }
+
+    bool AllUpdated(Subscribers &aSubscribers)
+    {
+      bool updated = true;
+
+      aSubscribers.ForEach([&updated](auto *aSubscriber)
+      {
+        updated = updated && (cSends == aSubscriber->mUpdates);
+      });
+
+      return updated;
+    }
+  }
+
+  bool TickDispatch(YTE::Engine *aEngine)
+  {
+    YTE::UnusedArguments(aEngine);
+
+    // Declared first, so the subscribers (which own the registrations) go
+    // before the lists they're in.
+    YTE::EventHandler delegateSource;
+    YTE::EventHandler tickSource;
+
+    Subscribers delegates;
+    Subscribers ticks;
+    MakeSubscribers(delegates);
+    MakeSubscribers(ticks);
+
+    delegates.ForEach([&delegateSource](auto *aSubscriber)
+    {
+      using Type = std::remove_pointer_t<decltype(aSubscriber)>;
+      delegateSource.RegisterEvent<&Type::Update>(YTE::Events::LogicUpdate, aSubscriber);
+    });
+
+    ticks.ForEach([&tickSource](auto *aSubscriber)
+    {
+      using Type = std::remove_pointer_t<decltype(aSubscriber)>;
+      tickSource.RegisterTick<&Type::Update>(YTE::Events::LogicUpdate, aSubscriber);
+    });
+
+    double delegateMicroseconds = Send(delegateSource);
+    double tickMicroseconds = Send(tickSource);
+
+    std::printf("LogicUpdate to %zu subscribers of 4 types, microseconds per send (best of %zu)\n",
+                cSubscribers,
+                cSends);
+    std::printf("%-16s %12.1f\n", "RegisterEvent", delegateMicroseconds);
+    std::printf("%-16s %12.1f\n", "RegisterTick", tickMicroseconds);
+
+    bool passed = AllUpdated(delegates) && AllUpdated(ticks);
+
+    if (false == passed)
+    {
+      std::printf("a subscriber missed an update\n");
+    }
+
+    return passed;
+  }
+}
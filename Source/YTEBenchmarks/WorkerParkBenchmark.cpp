@@ -0,0 +1,110 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "YTE/Core/Threading/JobSystem.hpp"
+
+#include "YTEBenchmarks/Benchmark.hpp"
+
+namespace YTEBenchmarks
+{
+  namespace
+  {
+    // Microseconds from queueing a job on the main thread to a background
+    // worker starting it. The main thread never runs jobs itself here, it
+    // only watches, so every job has to be stolen.
+    std::vector<double> WakeLatencies(YTE::JobSystem *aJobs, size_t aSamples, std::chrono::microseconds aGap)
+    {
+      std::vector<double> latencies;
+      latencies.reserve(aSamples);
+
+      for (size_t i = 0; i < aSamples; ++i)
+      {
+        // Long enough and the workers have given up spinning and parked.
+        std::this_thread::sleep_for(aGap);
+
+        Clock::time_point started;
+        auto queued = Clock::now();
+
+        auto handle = aJobs->QueueJobThisThread([&started](YTE::JobHandle&)
+        {
+          started = Clock::now();
+        });
+
+        while (false == handle.HasCompleted())
+        {
+          std::this_thread::yield();
+        }
+
+        latencies.push_back(std::chrono::duration<double, std::micro>(started - queued).count());
+      }
+
+      return latencies;
+    }
+
+    void PrintLatencies(char const *aName, std::vector<double> const &aLatencies)
+    {
+      std::printf("%-28s %10.1f %10.1f %10.1f\n",
+                  aName,
+                  Percentile(aLatencies, 50.0),
+                  Percentile(aLatencies, 99.0),
+                  Percentile(aLatencies, 100.0));
+    }
+  }
+
+  bool WorkerWakeLatency(YTE::Engine *aEngine)
+  {
+    constexpr size_t cSamples = 500;
+
+    auto jobs = MakeJobSystem(aEngine, "{ \"IOThreads\": 0 }");
+
+    if (0 == BackgroundWorkers(jobs.get()))
+    {
+      std::printf("no background workers, nothing to wake\n");
+      return true;
+    }
+
+    std::printf("%zu samples, microseconds from queue to start\n", cSamples);
+    std::printf("%-28s %10s %10s %10s\n", "", "median", "99th", "max");
+
+    PrintLatencies("busy (queued back to back)", WakeLatencies(jobs.get(), cSamples, std::chrono::microseconds(0)));
+    PrintLatencies("parked (20ms between jobs)", WakeLatencies(jobs.get(), cSamples, std::chrono::microseconds(20000)));
+
+    return true;
+  }
+
+  // CPU the whole process burns while every worker has nothing to do, as a
+  // percentage of one processor. The main thread is asleep for all of it,
+  // so this is the workers' spinning and waking up.
+  bool WorkerIdleCpu(YTE::Engine *aEngine)
+  {
+    constexpr double cSeconds = 2.0;
+
+    auto jobs = MakeJobSystem(aEngine, "{ \"IOThreads\": 0 }");
+
+    // Let them run out of spinning first.
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    double cpuBegin = ProcessCpuSeconds();
+    auto begin = Clock::now();
+
+    std::this_thread::sleep_for(std::chrono::duration<double>(cSeconds));
+
+    double cpu = ProcessCpuSeconds() - cpuBegin;
+    double wall = SecondsSince(begin);
+
+    std::printf("%zu background workers idle for %.1fs: %.2f%% of one processor\n",
+                BackgroundWorkers(jobs.get()),
+                wall,
+                100.0 * cpu / wall);
+
+    return true;
+  }
+}
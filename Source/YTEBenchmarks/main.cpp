@@ -0,0 +1,98 @@
+/******************************************************************************/
+/*!
+\author Evan T. Collier
+All content (c) 2017 DigiPen  (USA) Corporation, all rights reserved.
+*/
+/******************************************************************************/
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "YTE/Core/Engine.hpp"
+
+#include "YTEBenchmarks/Benchmark.hpp"
+
+using namespace YTEBenchmarks;
+
+namespace
+{
+  Benchmark const cBenchmarks[] = {
+    { "JobQueueStress", &JobQueueStress, false },
+    { "JobQueueThroughput", &JobQueueThroughput, false },
+    { "WorkerWakeLatency", &WorkerWakeLatency, true },
+    { "WorkerIdleCpu", &WorkerIdleCpu, true },
+    { "JobThroughput", &JobThroughput, true },
+    { "NestedWaits", &NestedWaits, true },
+    { "TickDispatch", &TickDispatch, false },
+    { "SingleThreadedJobs", &SingleThreadedJobs, true },
+    { "GUIDRegistry", &GUIDRegistry, true },
+    { "LevelLoad", &LevelLoad, true },
+    { "LevelLoadScaling", &LevelLoadScaling, true },
+    { "LevelLoaderOrder", &LevelLoaderOrder, true },
+  };
+}
+
+// YTEBenchmarks [name ...]
+// Runs the named benchmarks, or all of them, and returns non-zero if any
+// check failed.
+int main(int aArgumentCount, char *aArguments[])
+{
+  std::vector<Benchmark const*> selected;
+
+  for (auto &benchmark : cBenchmarks)
+  {
+    bool wanted = (aArgumentCount < 2);
+
+    for (int i = 1; i < aArgumentCount; ++i)
+    {
+      wanted = wanted || (0 == std::strcmp(aArguments[i], benchmark.mName));
+    }
+
+    if (wanted)
+    {
+      selected.push_back(&benchmark);
+    }
+  }
+
+  if (selected.empty())
+  {
+    std::printf("Unknown benchmark, the benchmarks are:\n");
+
+    for (auto &benchmark : cBenchmarks)
+    {
+      std::printf("  %s\n", benchmark.mName);
+    }
+
+    return 1;
+  }
+
+  std::unique_ptr<YTE::Engine> engine;
+  bool passed = true;
+
+  for (auto benchmark : selected)
+  {
+    if (benchmark->mNeedsEngine && nullptr == engine)
+    {
+      YTE::InitializeYTETypes();
+
+      // Editor mode, so no windows are made. The engine is only there to own
+      // the JobSystems the benchmarks make, it's never initialized or updated.
+      engine = std::make_unique<YTE::Engine>(std::vector<const char*>{ "../../../../../Assets/Bin/Config",
+                                                                      "./Config" },
+                                             true);
+    }
+
+    std::printf("== %s\n", benchmark->mName);
+
+    if (false == benchmark->mFunction(engine.get()))
+    {
+      std::printf("** %s FAILED\n", benchmark->mName);
+      passed = false;
+    }
+
+    std::printf("\n");
+  }
+
+  return passed ? 0 : 1;
+}